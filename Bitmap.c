@@ -0,0 +1,245 @@
+/** \file
+ *
+ *  Row by row access to the image in flash. The image is either the raw 1bpp bitmap
+ *  image_data, or with IMAGE_RLE one of the compressed streams listed in image_table by
+ *  png2c.py -c, picked with Bitmap_Select. With IMAGE_UART the raw rows are streamed by
+ *  the host instead (see Uart.h and png2uart.py). In compressed images every row is a list
+ *  of run lengths, alternating pixels left as in the row above and pixels flipped from it,
+ *  starting with a (maybe empty) unchanged run. The row above the first one is white. A run
+ *  length is one byte when below 128, otherwise two bytes, big endian, with the top bit of
+ *  the first one set.
+ *  Images printed by their plan alone (IMAGE_NO_RASTER) have no stream, and 0 in image_table.
+ *
+ *  Only the current row and the next one are ever decoded, into two row buffers.
+ */
+
+#include "Bitmap.h"
+
+#include <string.h>
+
+#if defined(IMAGE_UART)
+// Current and next rows.
+static uint8_t rows[2][BITMAP_STRIDE];
+static uint8_t current;
+#elif defined(IMAGE_RLE)
+extern const uint8_t image_count PROGMEM;
+extern const uint8_t image_flags[] PROGMEM;
+extern const uint8_t* const image_plan[] PROGMEM;
+extern const uint8_t* const image_table[] PROGMEM;
+
+// Selected image, current and next rows, and the read position in its stream.
+static uint8_t image;
+static uint8_t rows[2][BITMAP_STRIDE];
+static uint8_t current;
+static const uint8_t* rle;
+#else
+extern const uint8_t image_data[0x12c1] PROGMEM;
+extern const uint8_t image_flags[1] PROGMEM;
+extern const uint8_t* const image_plan[1] PROGMEM;
+#endif
+
+BitmapCursor_t bitmap_cursor;
+
+// Index of the current row.
+static uint8_t row;
+// Black extents of the current row and of the next one.
+static int16_t first[2];
+static int16_t last[2];
+
+#if defined(IMAGE_UART)
+// Receive the next row into buffer to.
+static void ReceiveRow(const uint8_t to)
+{
+	for (uint8_t i = 0; i < BITMAP_STRIDE; i++)
+		rows[to][i] = Uart_Read();
+}
+#elif defined(IMAGE_RLE)
+// Decode the row after buffer from into buffer to.
+static void DecodeRow(const uint8_t from, const uint8_t to)
+{
+	memcpy(rows[to], rows[from], BITMAP_STRIDE);
+
+	bool flip = false;
+	uint16_t x = 0;
+	while (x < BITMAP_WIDTH)
+	{
+		uint16_t run = pgm_read_byte(rle++);
+		if (run & 0x80)
+			run = (run & 0x7F) << 8 | pgm_read_byte(rle++);
+		if (flip)
+			for (uint16_t end = x + run; x < end; x++)
+				rows[to][x / 8] ^= 1 << (x % 8);
+		else
+			x += run;
+		flip = !flip;
+	}
+}
+#endif
+
+// Find the black extents of a row, from RAM or from flash.
+static void ScanRow(const uint8_t* const bytes, const bool flash, const uint8_t slot)
+{
+	first[slot] = BITMAP_WIDTH;
+	last[slot] = -1;
+	for (uint8_t i = 0; i < BITMAP_STRIDE; i++)
+	{
+		uint8_t byte = flash ? pgm_read_byte(&bytes[i]) : bytes[i];
+		if (byte)
+		{
+			if (first[slot] == BITMAP_WIDTH)
+				first[slot] = i * 8 + __builtin_ctz(byte);
+			last[slot] = i * 8 + (8 * sizeof(int) - 1 - __builtin_clz(byte));
+		}
+	}
+}
+
+// Get the extents of the row below the current one, and decode it if needed.
+static void LoadNext(void)
+{
+	if (row + 1 >= BITMAP_HEIGHT)
+	{
+		first[1] = BITMAP_WIDTH;
+		last[1] = -1;
+		return;
+	}
+#if defined(IMAGE_UART)
+	ReceiveRow(current ^ 1);
+	ScanRow(rows[current ^ 1], false, 1);
+#elif defined(IMAGE_RLE)
+	DecodeRow(current, current ^ 1);
+	ScanRow(rows[current ^ 1], false, 1);
+#else
+	ScanRow(&image_data[(row + 1) * BITMAP_STRIDE], true, 1);
+#endif
+}
+
+// Number of images in flash.
+uint8_t Bitmap_Count(void)
+{
+#ifdef IMAGE_RLE
+	return pgm_read_byte(&image_count);
+#else
+	return 1;
+#endif
+}
+
+// Pick the image to print from the next Bitmap_Begin on, the first one when out of range.
+void Bitmap_Select(const uint8_t index)
+{
+#ifdef IMAGE_RLE
+	image = index < Bitmap_Count() ? index : 0;
+#endif
+}
+
+// Flags of the selected image.
+uint8_t Bitmap_Flags(void)
+{
+#if defined(IMAGE_UART)
+	return 0;
+#elif defined(IMAGE_RLE)
+	return pgm_read_byte(&image_flags[image]);
+#else
+	return pgm_read_byte(&image_flags[0]);
+#endif
+}
+
+// Plan of the selected image, NULL if it has none.
+const uint8_t* Bitmap_Plan(void)
+{
+#if defined(IMAGE_UART)
+	return NULL;
+#elif defined(IMAGE_RLE)
+	return pgm_read_ptr(&image_plan[image]);
+#else
+	return pgm_read_ptr(&image_plan[0]);
+#endif
+}
+
+// Whether the rows needed by the next Bitmap_Begin (begin = true) or Bitmap_NextRow are in memory.
+bool Bitmap_Ready(const bool begin)
+{
+#ifdef IMAGE_UART
+	if (begin)
+		return Uart_Available() >= 2 * BITMAP_STRIDE;
+	return row + 2 >= BITMAP_HEIGHT || Uart_Available() >= BITMAP_STRIDE;
+#else
+	return true;
+#endif
+}
+
+// Go back to the first row of the image.
+void Bitmap_Begin(void)
+{
+	row = 0;
+#if defined(IMAGE_UART)
+	current = 0;
+	ReceiveRow(0);
+	ScanRow(rows[0], false, 0);
+	bitmap_cursor.Byte = rows[0];
+#elif defined(IMAGE_RLE)
+	// Decode the first row against a white one.
+	rle = pgm_read_ptr(&image_table[image]);
+	current = 0;
+	memset(rows[1], 0, BITMAP_STRIDE);
+	DecodeRow(1, 0);
+	ScanRow(rows[0], false, 0);
+	bitmap_cursor.Byte = rows[0];
+#else
+	ScanRow(image_data, true, 0);
+	bitmap_cursor.Byte = image_data;
+#endif
+	bitmap_cursor.Mask = 0x01;
+	bitmap_cursor.Bits = BITMAP_READ(bitmap_cursor.Byte);
+	LoadNext();
+}
+
+// Move on to the next row of the image.
+void Bitmap_NextRow(void)
+{
+	row++;
+#if defined(IMAGE_RLE) || defined(IMAGE_UART)
+	// Same column in the other row buffer.
+	bitmap_cursor.Byte = rows[current ^ 1] + (bitmap_cursor.Byte - rows[current]);
+	current ^= 1;
+#else
+	bitmap_cursor.Byte += BITMAP_STRIDE;
+#endif
+	bitmap_cursor.Bits = BITMAP_READ(bitmap_cursor.Byte);
+	first[0] = first[1];
+	last[0] = last[1];
+	LoadNext();
+}
+
+// Put the cursor on pixel x of the current row.
+void Bitmap_Seek(const uint16_t x)
+{
+#if defined(IMAGE_RLE) || defined(IMAGE_UART)
+	bitmap_cursor.Byte = rows[current] + x / 8;
+#else
+	bitmap_cursor.Byte = image_data + row * BITMAP_STRIDE + x / 8;
+#endif
+	bitmap_cursor.Mask = 1 << (x % 8);
+	bitmap_cursor.Bits = BITMAP_READ(bitmap_cursor.Byte);
+}
+
+// Whether pixel x of the current row is black.
+bool Bitmap_IsBlack(const uint16_t x)
+{
+#if defined(IMAGE_RLE) || defined(IMAGE_UART)
+	return rows[current][x / 8] & 1 << (x % 8);
+#else
+	return pgm_read_byte(&image_data[x / 8 + row * BITMAP_STRIDE]) & 1 << (x % 8);
+#endif
+}
+
+// Leftmost black pixel of the current row (next = false) or of the one below it, BITMAP_WIDTH when blank.
+int16_t Bitmap_First(const bool next)
+{
+	return first[next];
+}
+
+// Rightmost black pixel of the current row (next = false) or of the one below it, -1 when blank.
+int16_t Bitmap_Last(const bool next)
+{
+	return last[next];
+}
@@ -0,0 +1,104 @@
+/** \file
+ *
+ *  Header file for Bitmap.c.
+ */
+
+#ifndef _BITMAP_H_
+#define _BITMAP_H_
+
+// Includes
+#include <avr/pgmspace.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "AppConfig.h"
+#include "Uart.h"
+
+// Macros
+// Canvas size in pixels, and bytes per row of the raw 1bpp image.
+#define BITMAP_WIDTH  320
+#define BITMAP_HEIGHT 120
+#define BITMAP_STRIDE (BITMAP_WIDTH / 8)
+
+// Raw images are read from flash, the others from row buffers in RAM.
+#if defined(IMAGE_RLE) || defined(IMAGE_UART)
+	#define BITMAP_READ(byte) (*(byte))
+#else
+	#define BITMAP_READ(byte) pgm_read_byte(byte)
+#endif
+
+// Image flags, from image_flags in image.c.
+// The pixels set are erased with B out of a canvas the plan filled, rather than inked with A.
+#define IMAGE_ERASE     0x01
+// The plan prints the whole image, there is no row by row pass after it.
+#define IMAGE_NO_RASTER 0x02
+// The canvas is left as it is instead of being cleared, the plan only changes what differs from the last post.
+#define IMAGE_KEEP      0x04
+
+// Type Defines
+// Pixel under the pen: its byte, its bit in the byte, and a copy of the byte.
+typedef struct {
+	const uint8_t* Byte;
+	uint8_t Mask;
+	uint8_t Bits;
+} BitmapCursor_t;
+
+// Global Variables
+// Kept by Bitmap_Begin and Bitmap_NextRow, moved by Bitmap_Left and Bitmap_Right.
+extern BitmapCursor_t bitmap_cursor;
+
+// Function Prototypes
+// Number of images in flash.
+uint8_t Bitmap_Count(void);
+// Pick the image to print from the next Bitmap_Begin on, the first one when out of range.
+void Bitmap_Select(const uint8_t index);
+// Flags of the selected image.
+uint8_t Bitmap_Flags(void);
+// Plan of the selected image, NULL if it has none.
+const uint8_t* Bitmap_Plan(void);
+// Whether the rows needed by the next Bitmap_Begin (begin = true) or Bitmap_NextRow are in memory.
+// Streamed rows may still be on their way, flash ones are always there.
+bool Bitmap_Ready(const bool begin);
+// Go back to the first row of the image.
+void Bitmap_Begin(void);
+// Move on to the next row of the image.
+void Bitmap_NextRow(void);
+// Put the cursor on pixel x of the current row.
+void Bitmap_Seek(const uint16_t x);
+// Whether pixel x of the current row is black.
+bool Bitmap_IsBlack(const uint16_t x);
+// Leftmost black pixel of the current row (next = false) or of the one below it, BITMAP_WIDTH when blank.
+int16_t Bitmap_First(const bool next);
+// Rightmost black pixel of the current row (next = false) or of the one below it, -1 when blank.
+int16_t Bitmap_Last(const bool next);
+
+// Whether the pixel under the cursor is black: pixel 0 of the current row after Bitmap_Begin,
+// and the same column of the new row after Bitmap_NextRow.
+static inline bool Bitmap_Ink(void)
+{
+	return bitmap_cursor.Bits & bitmap_cursor.Mask;
+}
+
+// Move the cursor one pixel right, the flash or RAM byte is only read when crossing into the next one.
+static inline void Bitmap_Right(void)
+{
+	bitmap_cursor.Mask <<= 1;
+	if (!bitmap_cursor.Mask)
+	{
+		bitmap_cursor.Mask = 0x01;
+		bitmap_cursor.Bits = BITMAP_READ(++bitmap_cursor.Byte);
+	}
+}
+
+// Move the cursor one pixel left.
+static inline void Bitmap_Left(void)
+{
+	bitmap_cursor.Mask >>= 1;
+	if (!bitmap_cursor.Mask)
+	{
+		bitmap_cursor.Mask = 0x80;
+		bitmap_cursor.Bits = BITMAP_READ(--bitmap_cursor.Byte);
+	}
+}
+
+#endif
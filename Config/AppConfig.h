@@ -0,0 +1,27 @@
+// Application Configuration Header File. Used to select the optional firmware features, as an alternative to the compile-time defines.
+#ifndef _APP_CONFIG_H_
+#define _APP_CONFIG_H_
+	// Put the printer state and an event code on spare PORTB pins, for logic analyzer captures (see trace2timeline.py).
+	// #define TRACE_STATES
+	// Start pairing as soon as the host is seen ready, instead of the fixed 2 seconds SYNC_CONTROLLER sequence.
+	// #define ADAPTIVE_SYNC
+	// Stop repeating a printing report as soon as the host mirrored it back in an OUT report, instead of always sending ECHOES copies.
+	// #define OUT_FEEDBACK
+	// Keep statistics of the IN report intervals in poll_stats, and toggle RX_LED every PROFILE_BLINK_REPORTS reports.
+	// #define PROFILE
+	// Add a CDC-ACM serial interface streaming binary telemetry to a PC, on an atmega32u4 or at90usb1286 only (see Telemetry.h).
+	// #define TELEMETRY
+
+	// The image.c in use is compressed, made with png2c.py -c.
+	// #define IMAGE_RLE
+	// Select the image to print at boot with jumpers from PB4 to PB6 to ground, remembered in EEPROM (see SelectImage in Joystick.c).
+	// #define IMAGE_STRAPS
+	// Print the raw image rows streamed by png2uart.py on USART1 as they come, instead of an image in flash (see Uart.h).
+	// #define IMAGE_UART
+
+	// Act as a real fightstick reading the buttons and lever wired to PORTB and PORTD (see Fightstick.h), instead of printing.
+	// #define FIGHTSTICK
+	// Run timed button timelines (turbo, holds) on a timer wheel ticked by the Timer1 millisecond clock (see Macro.h).
+	// With FIGHTSTICK, holding ZR turbos A at 15 Hz, and pushing ZL holds B for 500 ms while turning the left stick.
+	// #define MACROS
+#endif
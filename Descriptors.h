@@ -4,6 +4,8 @@
 // Includes
 #include <LUFA/Drivers/USB/USB.h>
 
+#include "AppConfig.h"
+
 #include <avr/pgmspace.h>
 
 // Type Defines
@@ -17,12 +19,29 @@ typedef struct
 	USB_HID_Descriptor_HID_t              HID_JoystickHID;
 	USB_Descriptor_Endpoint_t             HID_ReportOUTEndpoint;
 	USB_Descriptor_Endpoint_t             HID_ReportINEndpoint;
+
+#ifdef TELEMETRY
+	// Telemetry CDC-ACM Function
+	USB_Descriptor_Interface_Association_t CDC_IAD;
+	USB_Descriptor_Interface_t            CDC_CCI_Interface;
+	USB_CDC_Descriptor_FunctionalHeader_t CDC_Functional_Header;
+	USB_CDC_Descriptor_FunctionalACM_t    CDC_Functional_ACM;
+	USB_CDC_Descriptor_FunctionalUnion_t  CDC_Functional_Union;
+	USB_Descriptor_Endpoint_t             CDC_NotificationEndpoint;
+	USB_Descriptor_Interface_t            CDC_DCI_Interface;
+	USB_Descriptor_Endpoint_t             CDC_DataOUTEndpoint;
+	USB_Descriptor_Endpoint_t             CDC_DataINEndpoint;
+#endif
 } USB_Descriptor_Configuration_t;
 
 // Device Interface Descriptor IDs
 enum InterfaceDescriptors_t
 {
 	INTERFACE_ID_Joystick = 0, /**< Joystick interface descriptor ID */
+#ifdef TELEMETRY
+	INTERFACE_ID_CDC_CCI  = 1, /**< Telemetry CDC control interface descriptor ID */
+	INTERFACE_ID_CDC_DCI  = 2, /**< Telemetry CDC data interface descriptor ID */
+#endif
 };
 
 // Device String Descriptor IDs
@@ -41,12 +60,21 @@ enum StringDescriptors_t
 // The Switch -needs- this to be 64.
 // The Wii U is flexible, allowing us to use the default of 8 (which did not match the original Hori descriptors).
 #define JOYSTICK_EPSIZE           64
+// Telemetry CDC Endpoint Addresses and Sizes, past the 4 endpoints of the atmega16u2.
+#define CDC_NOTIFICATION_EPADDR   (ENDPOINT_DIR_IN  | 3)
+#define CDC_TX_EPADDR             (ENDPOINT_DIR_IN  | 4)
+#define CDC_RX_EPADDR             (ENDPOINT_DIR_OUT | 5)
+#define CDC_NOTIFICATION_EPSIZE   8
+#define CDC_TXRX_EPSIZE           64
 // Descriptor Header Type - HID Class HID Descriptor
 #define DTYPE_HID                 0x21
 // Descriptor Header Type - HID Class HID Report Descriptor
 #define DTYPE_Report              0x22
 // Joystick endpoint polling interval (in ms). It looks like any value set here renders in a timing multiple of 8 ms.
-#define POLLING_MS 8
+// Set it from the makefile to try other values, and build with PROFILE to measure what the host actually does.
+#ifndef POLLING_MS
+	#define POLLING_MS 8
+#endif
 
 // Function Prototypes
 uint16_t CALLBACK_USB_GetDescriptor(
@@ -0,0 +1,258 @@
+/** \file
+ *
+ *  Physical fightstick: buttons and lever switches wired to PORTB and PORTD,
+ *  sampled and debounced in a timer interrupt.
+ */
+
+#include "Fightstick.h"
+
+#ifdef FIGHTSTICK
+
+#include "Ring.h"
+
+#ifdef FIGHTSTICK_REMAP
+// Button reported for each bit of the pin word, 0 for the lever and unused pins.
+static const uint16_t button_map[16] PROGMEM = {
+	SWITCH_Y, SWITCH_B, SWITCH_A,  SWITCH_X,    SWITCH_L, SWITCH_R, SWITCH_ZL,    SWITCH_ZR,   // PB0..PB7
+	0,        0,        0,         0,           0,        0,        SWITCH_MINUS, SWITCH_PLUS, // PD0..PD7
+};
+#endif
+
+// One integrator per pin: counts up while the pin reads pressed, down while it reads released.
+static uint8_t integrators[16];
+
+// A change of the debounced pin word, where a set bit is a pressed input, with the timer ticks at which it happened.
+typedef struct {
+	uint16_t Pressed;
+	uint16_t Ticks;
+} InputChange_t;
+
+#define INPUT_CHANGES 8
+RING_DEFINE(InputRing, InputChange_t, INPUT_CHANGES)
+
+// Changes from the sampling interrupt to the report builder.
+static InputRing_t changes;
+// Times of the changes first carried by the report being built, for latency_stats once it is sent.
+static uint16_t sent_ticks[INPUT_CHANGES];
+static uint8_t sent_changes = 0;
+// Debounced pin word as the integrators left it, with the timer ticks of its last change, as last
+// queued by the interrupt, and as last read by the report builder.
+static uint16_t debounced = 0;
+static uint16_t debounced_ticks;
+static uint16_t queued = 0;
+static uint16_t pressed = 0;
+
+// Setup the input pins and start sampling them.
+void Fightstick_Init(void)
+{
+	DDRB &= (uint8_t)~FIGHTSTICK_PINS_B;
+	PORTB |= FIGHTSTICK_PINS_B;
+	DDRD &= (uint8_t)~FIGHTSTICK_PINS_D;
+	PORTD |= FIGHTSTICK_PINS_D;
+
+	// Timer0 in CTC mode, F_CPU / 64.
+	TCCR0A = (1 << WGM01);
+	TCCR0B = (1 << CS01) | (1 << CS00);
+	OCR0A = F_CPU / 64 / FIGHTSTICK_SAMPLE_HZ - 1;
+	TIMSK0 = (1 << OCIE0A);
+}
+
+// Sample all the inputs and run the integrators.
+ISR(TIMER0_COMPA_vect)
+{
+	uint16_t raw = ~(PINB | (uint16_t)PIND << 8) & FIGHTSTICK_PINS;
+	uint16_t state = debounced;
+
+	for (uint8_t i = 0; i < 16; i++)
+	{
+		uint16_t bit = 1U << i;
+		if (raw & bit)
+		{
+			if (integrators[i] < FIGHTSTICK_DEBOUNCE && ++integrators[i] == FIGHTSTICK_DEBOUNCE)
+				state |= bit;
+		}
+		else
+		{
+			if (integrators[i] > 0 && --integrators[i] == 0)
+				state &= ~bit;
+		}
+	}
+
+	if (state != debounced)
+	{
+		debounced = state;
+		debounced_ticks = Timer_Ticks();
+	}
+
+	// While the ring is full, the debounced word is pushed again at every sample until it fits.
+	if (debounced != queued)
+	{
+		InputChange_t change = {.Pressed = debounced, .Ticks = debounced_ticks};
+		if (InputRing_Push(&changes, &change))
+			queued = debounced;
+	}
+}
+
+#ifdef PROFILE
+	// Time each stage, leaving out the time it takes to record it.
+	#define STAGE_BEGIN()     uint16_t stage_ticks = Timer_Ticks()
+	#define STAGE_END(stage)  do { Profiler_RecordStage(stage, Timer_Ticks() - stage_ticks); stage_ticks = Timer_Ticks(); } while (0)
+#else
+	#define STAGE_BEGIN()
+	#define STAGE_END(stage)
+#endif
+
+// Resolve opposite lever directions into at most one per axis.
+static inline uint16_t ResolveSOCD(uint16_t inputs)
+{
+#if (SOCD_MODE == SOCD_LAST_INPUT)
+	// The direction pressed last on each axis, and the lever before this report.
+	static uint16_t last = 0;
+	static uint16_t previous = 0;
+
+	uint16_t pushed = inputs & ~previous;
+	previous = inputs;
+	if (pushed & LEVER_X)
+		last = (last & LEVER_Y) | (pushed & LEVER_X);
+	if (pushed & LEVER_Y)
+		last = (last & LEVER_X) | (pushed & LEVER_Y);
+
+	if ((inputs & LEVER_X) == LEVER_X)
+		inputs &= ~LEVER_X | last;
+	if ((inputs & LEVER_Y) == LEVER_Y)
+		inputs &= ~LEVER_Y | last;
+#elif (SOCD_MODE == SOCD_UP_PRIORITY)
+	if ((inputs & LEVER_X) == LEVER_X)
+		inputs &= ~LEVER_X;
+	if ((inputs & LEVER_Y) == LEVER_Y)
+		inputs &= ~LEVER_DOWN;
+#else
+	if ((inputs & LEVER_X) == LEVER_X)
+		inputs &= ~LEVER_X;
+	if ((inputs & LEVER_Y) == LEVER_Y)
+		inputs &= ~LEVER_Y;
+#endif
+	return inputs;
+}
+
+// Map the resolved lever to a HAT value.
+static inline uint8_t LeverToHAT(const uint16_t inputs)
+{
+	// Indexed by the lever bits shifted down: up, down, left, right.
+	static const uint8_t hats[16] PROGMEM = {
+		HAT_CENTER, HAT_TOP,       HAT_BOTTOM,       HAT_CENTER,
+		HAT_LEFT,   HAT_TOP_LEFT,  HAT_BOTTOM_LEFT,  HAT_LEFT,
+		HAT_RIGHT,  HAT_TOP_RIGHT, HAT_BOTTOM_RIGHT, HAT_RIGHT,
+		HAT_CENTER, HAT_TOP,       HAT_BOTTOM,       HAT_CENTER,
+	};
+	return pgm_read_byte(&hats[(inputs >> 8) & 0x0F]);
+}
+
+// Map the button pins to the report buttons.
+static inline uint16_t RemapButtons(const uint16_t inputs)
+{
+#ifdef FIGHTSTICK_REMAP
+	uint16_t buttons = 0;
+	for (uint8_t i = 0; i < 16; i++)
+		if (inputs & (1U << i))
+			buttons |= pgm_read_word(&button_map[i]);
+	return buttons;
+#else
+	return (inputs & 0xFF) | ((inputs >> 6) & (SWITCH_MINUS | SWITCH_PLUS));
+#endif
+}
+
+#ifdef FIGHTSTICK_TURBO
+// Release the turbo buttons every other FIGHTSTICK_TURBO_REPORTS reports.
+static inline uint16_t ApplyTurbo(const uint16_t buttons)
+{
+	static uint8_t reports = 0;
+
+	if (++reports == 2 * FIGHTSTICK_TURBO_REPORTS)
+		reports = 0;
+	if (reports >= FIGHTSTICK_TURBO_REPORTS)
+		return buttons & ~FIGHTSTICK_TURBO;
+	return buttons;
+}
+#endif
+
+#ifdef MACROS
+// Left stick path run by the macros.
+static Trajectory_t left_path;
+
+// Start and stop the macro timelines bound to button edges, and add their buttons.
+static inline uint16_t ApplyMacros(const uint16_t buttons)
+{
+	static uint16_t previous = 0;
+	static uint8_t turbo = MACRO_NONE;
+
+	uint16_t pushed = buttons & ~previous;
+	uint16_t released = previous & ~buttons;
+	previous = buttons;
+
+	// Turbo A at 15 Hz while ZR is held.
+	if (pushed & SWITCH_ZR)
+		turbo = Macro_Turbo(SWITCH_A, 66);
+	if (released & SWITCH_ZR)
+	{
+		Macro_Stop(turbo);
+		turbo = MACRO_NONE;
+	}
+	// Hold B for 500 ms while turning the left stick once, in 64 reports.
+	if (pushed & SWITCH_ZL)
+	{
+		Macro_Hold(SWITCH_B, 500);
+		Stick_Circle(&left_path, 0, 0, 127, 64, 64);
+	}
+
+	return buttons | Macro_Buttons();
+}
+#endif
+
+// Build a report from the latest debounced inputs.
+void Fightstick_GetReport(USB_JoystickReport_Input_t* const ReportData)
+{
+	// Catch up with all the changes since the last report, keeping their times until it is sent.
+	InputChange_t change;
+	while (InputRing_Pop(&changes, &change))
+	{
+		pressed = change.Pressed;
+		if (sent_changes < INPUT_CHANGES)
+			sent_ticks[sent_changes++] = change.Ticks;
+	}
+
+	memset(ReportData, 0, sizeof(USB_JoystickReport_Input_t));
+	ReportData->LX = STICK_CENTER;
+	ReportData->LY = STICK_CENTER;
+	ReportData->RX = STICK_CENTER;
+	ReportData->RY = STICK_CENTER;
+
+	STAGE_BEGIN();
+	uint16_t inputs = ResolveSOCD(pressed);
+	STAGE_END(STAGE_SOCD);
+	ReportData->HAT = LeverToHAT(inputs);
+	STAGE_END(STAGE_HAT);
+	uint16_t buttons = RemapButtons(inputs);
+	STAGE_END(STAGE_REMAP);
+#ifdef FIGHTSTICK_TURBO
+	buttons = ApplyTurbo(buttons);
+	STAGE_END(STAGE_TURBO);
+#endif
+#ifdef MACROS
+	buttons = ApplyMacros(buttons);
+	Stick_Next(&left_path, &ReportData->LX, &ReportData->LY);
+	STAGE_END(STAGE_MACROS);
+#endif
+	ReportData->Button = buttons;
+}
+
+// Time the changes carried by the report just handed to the USB controller.
+void Fightstick_ReportSent(void)
+{
+	uint16_t now = Timer_Ticks();
+	for (uint8_t i = 0; i < sent_changes; i++)
+		Profiler_RecordLatency(now - sent_ticks[i]);
+	sent_changes = 0;
+}
+
+#endif
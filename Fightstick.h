@@ -0,0 +1,74 @@
+/** \file
+ *
+ *  Header file for Fightstick.c.
+ */
+
+#ifndef _FIGHTSTICK_H_
+#define _FIGHTSTICK_H_
+
+// Includes
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <stdint.h>
+
+#include "Joystick.h"
+
+// Macros
+// Inputs are sampled by a Timer0 interrupt at this rate.
+#define FIGHTSTICK_SAMPLE_HZ 4000
+// Consecutive samples a pin must agree on before its debounced state changes (0.75 ms at 4 kHz).
+#define FIGHTSTICK_DEBOUNCE 3
+
+// Inputs are active low, with the internal pull-ups on. They are gathered in a 16-bit pin word:
+// bits 0..7 are PB0..PB7, bits 8..15 are PD0..PD7. PD4 and PD5 drive the TX/RX LEDs and are not inputs.
+#define FIGHTSTICK_PINS_B 0xFF
+#define FIGHTSTICK_PINS_D 0b11001111
+#define FIGHTSTICK_PINS   (FIGHTSTICK_PINS_B | (uint16_t)FIGHTSTICK_PINS_D << 8)
+
+// Lever switches, as pin word bits.
+#define LEVER_UP    (1 << 8)  // PD0
+#define LEVER_DOWN  (1 << 9)  // PD1
+#define LEVER_LEFT  (1 << 10) // PD2
+#define LEVER_RIGHT (1 << 11) // PD3
+#define LEVER_X     (LEVER_LEFT | LEVER_RIGHT)
+#define LEVER_Y     (LEVER_UP | LEVER_DOWN)
+
+// Input pipeline, every stage is selected at compile time and timed in pipeline_stats when PROFILE is on:
+// SOCD resolution, lever to HAT, button remapping, turbo and macros.
+
+// SOCD (Simultaneous Opposite Cardinal Directions) resolution.
+#define SOCD_NEUTRAL     0 // Opposite directions cancel out
+#define SOCD_LAST_INPUT  1 // The direction pressed last wins
+#define SOCD_UP_PRIORITY 2 // Up wins over down, left and right cancel out
+#ifndef SOCD_MODE
+	#define SOCD_MODE SOCD_NEUTRAL
+#endif
+
+// Remap the buttons through button_map in Fightstick.c. Otherwise PB0..PB7 are Y, B, A, X, L, R, ZL, ZR
+// and PD6, PD7 are Minus, Plus, which is a couple of shifts.
+// #define FIGHTSTICK_REMAP
+
+// Buttons that repeat by themselves while held, leave it out to skip the turbo stage,
+// and the number of reports they stay pressed then released (about 15 Hz at 8 ms).
+// #define FIGHTSTICK_TURBO         (SWITCH_A | SWITCH_B)
+#define FIGHTSTICK_TURBO_REPORTS 4
+
+// Pipeline stages, as indexes in pipeline_stats.
+enum {
+	STAGE_SOCD,
+	STAGE_HAT,
+	STAGE_REMAP,
+	STAGE_TURBO,
+	STAGE_MACROS,
+};
+
+// Function Prototypes
+// Setup the input pins and start sampling them.
+void Fightstick_Init(void);
+// Build a report from the latest debounced inputs.
+void Fightstick_GetReport(USB_JoystickReport_Input_t* const ReportData);
+// Time the changes carried by the report just handed to the USB controller.
+void Fightstick_ReportSent(void);
+
+#endif
@@ -0,0 +1,28 @@
+/** \file
+ *
+ *  Header file for Font.c.
+ */
+
+#ifndef _FONT_H_
+#define _FONT_H_
+
+// Includes
+#include <avr/pgmspace.h>
+#include <stdint.h>
+
+// Macros
+// Glyph size in pixels, and the room each one takes along a line and between lines. Must match planner.py.
+#define FONT_WIDTH   5
+#define FONT_HEIGHT  7
+#define FONT_ADVANCE 6
+#define FONT_LINE    8
+
+// Characters in the font, the others are written as '?'.
+#define FONT_FIRST ' '
+#define FONT_LAST  '~'
+
+// Function Prototypes
+// Pixels of a column of a glyph, the top one in the lowest bit.
+uint8_t Font_Column(const char c, const uint8_t column);
+
+#endif
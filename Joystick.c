@@ -25,14 +25,57 @@ these buttons for our use.
  */
 
 #include "Joystick.h"
+#include "Fightstick.h"
+
+#if defined(FIGHTSTICK) && defined(TRACE_STATES)
+	#error TRACE_STATES needs PORTB, which FIGHTSTICK uses for the buttons.
+#endif
+#if defined(IMAGE_STRAPS) && (defined(FIGHTSTICK) || defined(TRACE_STATES))
+	#error IMAGE_STRAPS reads PB4 to PB6, which FIGHTSTICK and TRACE_STATES use.
+#endif
+#if defined(IMAGE_UART) && (defined(FIGHTSTICK) || defined(IMAGE_RLE))
+	#error IMAGE_UART takes the image from the host, and uses PD2 and PD3, which FIGHTSTICK uses.
+#endif
+#if defined(TELEMETRY) && !defined(__AVR_ATmega32U4__) && !defined(__AVR_AT90USB1286__)
+	#error TELEMETRY needs endpoints past the fourth, on an atmega32u4 or at90usb1286.
+#endif
 
 #define TX_LED 0b00100000
 #define RX_LED 0b00010000
 #define Reset_Print 0b00001000
+#define Image_Straps 0b01110000
+#ifndef FIGHTSTICK
 #define Oscilloscope_A 0b00000100
 #define Oscilloscope_B 0b00000010
+#else
+// The buttons use the whole PORTB.
+#define Oscilloscope_A 0
+#define Oscilloscope_B 0
+#endif
+#define Trace_State 0b01110000
+#define Trace_Event 0b10000001
+
+// Repeat ECHOES times the last sent report, unless other timings were saved (see Timings_t).
+#define ECHOES 3
+
+// Set once the host sent its first OUT report.
+bool host_out_seen = false;
+
+// Set by EVENT_USB_Device_Disconnect, seen by the next report.
+volatile bool usb_dropped = false;
+
+// Number of IN reports prepared so far, used to order OUT reports against them.
+uint16_t report_seq = 0;
+
+// Printer timings, the ones saved in EEPROM replacing these defaults at boot.
+Timings_t timings = {ECHOES, 500, 1500, 4000};
 
-extern const uint8_t image_data[0x12c1] PROGMEM;
+#ifdef OUT_FEEDBACK
+// Last OUT report from the host, with the IN report count and timer ticks at which it came in.
+USB_JoystickReport_Output_t host_report;
+uint16_t host_report_seq;
+uint16_t host_report_ticks;
+#endif
 
 // Main entry point.
 int main(void)
@@ -49,11 +92,37 @@ int main(void)
 	{
 		// We need to run our task to process and deliver data for our IN and OUT endpoints.
 		HID_Task();
+#ifdef TELEMETRY
+		// Then the telemetry, which never waits for the host.
+		Telemetry_Task();
+#endif
 		// We also need to run the main USB management task.
 		USB_USBTask();
 	}
 }
 
+// Picks the image to print: the one saved in EEPROM, or with IMAGE_STRAPS the one set by
+// jumpers from PB4 (bit 0) to PB6 (bit 2) to ground, which is saved for the next boots.
+// No jumper keeps the saved image, jumpers worth n select image n - 1.
+static void SelectImage(void)
+{
+	uint8_t index = Settings_ImageIndex();
+#ifdef IMAGE_STRAPS
+	PORTB |= Image_Straps;
+	// Let the pull-ups charge the pins for 100 us.
+	uint16_t start = Timer_Ticks();
+	while ((uint16_t)(Timer_Ticks() - start) < TIMER_TICKS_PER_MS / 10);
+	uint8_t straps = (~PINB & Image_Straps) >> 4;
+	PORTB &= ~Image_Straps;
+	if (straps)
+	{
+		index = straps - 1;
+		Settings_SetImageIndex(index);
+	}
+#endif
+	Bitmap_Select(index);
+}
+
 // Configures hardware and peripherals, such as the USB peripherals.
 void SetupHardware(void)
 {
@@ -68,8 +137,24 @@ void SetupHardware(void)
 	DDRD = TX_LED | RX_LED;
 	PORTD = 0xFF;
 	DDRB = Oscilloscope_A | Oscilloscope_B;
+#ifdef TRACE_STATES
+	DDRB |= Trace_State | Trace_Event;
+#endif
 	PORTB = 0x00;
 
+	Timer_Init();
+	SelectImage();
+	Settings_Timings(&timings);
+#ifdef PROFILE
+	Profiler_Reset();
+#endif
+#ifdef FIGHTSTICK
+	Fightstick_Init();
+#endif
+#ifdef IMAGE_UART
+	Uart_Init();
+#endif
+
 	// The USB stack should be initialized last.
 	USB_Init();
 }
@@ -84,6 +169,8 @@ void EVENT_USB_Device_Connect(void)
 void EVENT_USB_Device_Disconnect(void)
 {
 	// We can indicate that our device is not ready (via status LEDs, sound, etc.).
+	// The print is picked up again with the first report after the next configuration.
+	usb_dropped = true;
 }
 
 // Fired when the host set the current configuration of the USB device after enumeration.
@@ -94,18 +181,13 @@ void EVENT_USB_Device_ConfigurationChanged(void)
 	// We setup the HID report endpoints.
 	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_OUT_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
 	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_IN_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
+#ifdef TELEMETRY
+	ConfigSuccess &= Telemetry_ConfigureEndpoints();
+#endif
 
 	// We can read ConfigSuccess to indicate a success or failure at this point.
 }
 
-// Process control requests sent to the device from the USB host.
-void EVENT_USB_Device_ControlRequest(void)
-{
-	// We can handle two control requests: a GetReport and a SetReport.
-
-	// Not used here, it looks like we don't receive control request from the Switch.
-}
-
 // Process and deliver data from IN and OUT endpoints.
 void HID_Task(void)
 {
@@ -126,11 +208,17 @@ void HID_Task(void)
 			// We'll then take in that data, setting it up in our storage.
 			while(Endpoint_Read_Stream_LE(&JoystickOutputData, sizeof(JoystickOutputData), NULL) != ENDPOINT_RWSTREAM_NoError);
 			// At this point, we can react to this data.
+#ifdef OUT_FEEDBACK
+			host_report = JoystickOutputData;
+			host_report_seq = report_seq;
+			host_report_ticks = Timer_Ticks();
+#endif
 
-			// However, since we're not doing anything with this data, we abandon it.
+			// Otherwise, since we're not doing anything with this data, we abandon it.
 		}
 		// Regardless of whether we reacted to the data, we acknowledge an OUT packet on this endpoint.
 		Endpoint_ClearOUT();
+		host_out_seen = true;
 
 		PORTB = (~PORTB & Oscilloscope_A) | (PORTB & ~Oscilloscope_A);
 	}
@@ -148,6 +236,10 @@ void HID_Task(void)
 		while(Endpoint_Write_Stream_LE(&JoystickInputData, sizeof(JoystickInputData), NULL) != ENDPOINT_RWSTREAM_NoError);
 		// We then send an IN packet on this endpoint.
 		Endpoint_ClearIN();
+#ifdef FIGHTSTICK
+		// The input changes in this report are now on their way to the host.
+		Fightstick_ReportSent();
+#endif
 
 		PORTB = (~PORTB & Oscilloscope_B) | (PORTB & ~Oscilloscope_B);
 	}
@@ -155,11 +247,12 @@ void HID_Task(void)
 
 // Sync the USB report stream to 30 fps, and enable the blanks skipping
 // #define SYNC_TO_30_FPS
+// Skip the blank ends of the rows: go down as soon as nothing is left to ink on the current row and on the way back.
 // #define SKIP_BLANKS
 
-// Repeat ECHOES times the last sent report.
-
-#define ECHOES 3
+// Buttons stepping the brush size up and down, used by the plans of planner.py.
+#define BRUSH_BIGGER SWITCH_R
+#define BRUSH_SMALLER SWITCH_L
 
 // Printer internal state
 typedef enum {
@@ -169,31 +262,367 @@ typedef enum {
 	STOP_Y,
 	MOVE_X,
 	MOVE_Y,
-	DONE
+	DONE,
+	PLAN
 } State_t;
 State_t state = SYNC_CONTROLLER;
 
+// Trace event codes, sampled along with the state on every IN packet.
+typedef enum {
+	TRACE_ECHO,  // The last report is being repeated
+	TRACE_MOVE,  // A new report in the same state
+	TRACE_ENTER, // A new report that switched to another state
+	TRACE_INK,   // A new report pressing the pen, A or B
+} TraceEvent_t;
+
 USB_JoystickReport_Input_t last_report;
-int echoes = 0;
+// Whether the last report is still repeated to the host, and until when on the Timer_Micros clock.
+bool holding = false;
+uint32_t hold_until;
 
-int command_count = 0;
+// Presses done in the schedule of the current sync state, -1 before its first report, and the Timer_Millis clock at that report.
+int presses = -1;
+uint32_t state_ms;
 
 int xpos = 0;
 int ypos = 0;
 
+// Button of the pen: A to ink, B to erase.
+uint16_t pen = SWITCH_A;
+
+// Plan command being carried out, reports left in it, and steps of its line done along X and Y.
+PlanCommand_t plan_command;
+uint16_t plan_left = 0;
+uint8_t plan_x;
+uint8_t plan_y;
+// End of the sweep under way on the Timer_Millis clock.
+uint32_t plan_until;
+
+// How to carry on once the USB connection is back after dropping mid-print (see Resume).
+typedef enum {
+	RESUME_NONE, // Print from scratch
+	RESUME_PLAN, // Start the plan of the image again, on the canvas as it is
+	RESUME_ROW,  // Go back to the start of resume_row and print again from it, on the canvas as it is
+} Resume_t;
+Resume_t resume = RESUME_NONE;
+int resume_row;
+
 #define max(a, b) (a > b ? a : b)
-#define ms_2_count(ms) (ms / (ECHOES + 1) / (max(POLLING_MS, 8) / 8 * 8))
-#define is_black(x, y) (pgm_read_byte(&(image_data[((x) / 8) + ((y) * 40)])) & 1 << ((x) % 8))
+#define min(a, b) (a < b ? a : b)
+// Timer_Micros at the last IN report.
+uint32_t last_report_us;
+
+// Each new report is held for itself and timings.Echoes more polls, less half a poll so that the jitter
+// of the host doesn't add a poll to it: a report lasts as long on the console whatever the poll rate.
+#define HOLD_US ((timings.Echoes + 1) * (max(POLLING_MS, 8) / 8 * 8) * 1000UL - POLLING_MS * 500UL)
+
+// Presses of the fixed pairing sequence, timings.PairingMs apart: L+R twice, then A twice.
+#define PAIRING_PRESSES 4
+
+#ifdef PROFILE
+// RX_LED toggles once per second when the host really polls every 8 ms.
+#define PROFILE_BLINK_REPORTS 125
+
+uint8_t blink_reports = 0;
+#endif
+
+#ifdef OUT_FEEDBACK
+// IN report count at which the last report was first sent, and whether we're waiting for the host to mirror it.
+uint16_t sent_seq;
+bool feedback_pending = false;
+// Reports acknowledged by the host, and reports whose hold ran out without it.
+uint16_t feedback_acks = 0;
+uint16_t feedback_timeouts = 0;
+#endif
+
+#ifdef ADAPTIVE_SYNC
+// The host is ready once it sent an OUT report and polls IN at a steady rate for this many reports.
+#define SYNC_STEADY_REPORTS 8
+// Never press anything sooner than this after configuration.
+#define SYNC_SETTLE_MS 250
+// Time between the L+R press, the A press and the end of SYNC_CONTROLLER.
+#define SYNC_GAP_MS 250
+
+uint16_t last_interval = 0;
+uint8_t steady_reports = 0;
+// Milliseconds into SYNC_CONTROLLER when the host was found ready, -1 until then.
+int sync_start = -1;
+#endif
+
+#ifdef TELEMETRY
+// State last sent as a TELEMETRY_STATE record.
+State_t telemetry_state = SYNC_CONTROLLER;
+#endif
+
+#ifdef TRACE_STATES
+// State goes to PB4..PB6, the event code low bit to PB0 and high bit to PB7.
+#define trace(s, e) (PORTB = (PORTB & ~(Trace_State | Trace_Event)) | ((s) << 4 & Trace_State) | ((e) & 0x01) | ((e) << 6 & 0x80))
+#else
+#define trace(s, e)
+#endif
+
+// Milliseconds since the first report of the current sync state, whose schedule starts there.
+static uint32_t StateMillis(void)
+{
+	uint32_t now = Timer_Millis();
+	if (presses < 0)
+	{
+		presses = 0;
+		state_ms = now;
+	}
+	return now - state_ms;
+}
+
+// Report step of the PLAN state. Returns true once the plan is over.
+static bool PlanStep(USB_JoystickReport_Input_t* const ReportData)
+{
+	// A sweep goes on until its time is up.
+	if (plan_command.Op == PLAN_SWEEP && plan_left > 0 && Timer_Reached(Timer_Millis(), plan_until))
+		plan_left = 0;
+
+	// Fetch commands until one that takes reports.
+	while (plan_left == 0)
+	{
+		if (!Plan_Fetch(&plan_command))
+			return true;
+		plan_x = 0;
+		plan_y = 0;
+		switch (plan_command.Op)
+		{
+			case PLAN_MOVE:
+			case PLAN_LINE:
+				plan_left = 2 * (abs(plan_command.A) + abs(plan_command.B));
+				break;
+			case PLAN_DOT:
+				plan_left = 1;
+				break;
+			case PLAN_BRUSH:
+				plan_left = 2 * abs(plan_command.A);
+				break;
+			case PLAN_PEN:
+				pen = plan_command.A ? SWITCH_B : SWITCH_A;
+				break;
+			case PLAN_SWEEP:
+				plan_left = 1;
+				plan_until = Timer_Millis() + (uint16_t)(uint8_t)plan_command.B * 16;
+				break;
+			case PLAN_STROKE:
+				plan_left = 2 * max(abs(plan_command.A), abs(plan_command.B));
+				break;
+		}
+	}
+	// Sweeps are timed, the other commands last a number of reports.
+	if (plan_command.Op != PLAN_SWEEP)
+		plan_left--;
+
+	switch (plan_command.Op)
+	{
+		case PLAN_LINE:
+			ReportData->Button |= pen;
+			// Fall through
+		case PLAN_MOVE:
+			// Every pixel is a HAT report then a neutral one.
+			if (plan_left % 2)
+			{
+				int ax = abs(plan_command.A);
+				int ay = abs(plan_command.B);
+				// Moves go along X first, lines step along X or Y whichever keeps closest to the line.
+				bool along_x = plan_x < ax && (plan_command.Op == PLAN_MOVE || plan_y >= ay
+					|| (2 * plan_x + 1) * ay <= (2 * plan_y + 1) * ax);
+				if (along_x)
+				{
+					ReportData->HAT = plan_command.A > 0 ? HAT_RIGHT : HAT_LEFT;
+					plan_x++;
+				}
+				else
+				{
+					ReportData->HAT = plan_command.B > 0 ? HAT_BOTTOM : HAT_TOP;
+					plan_y++;
+				}
+			}
+			break;
+		case PLAN_STROKE:
+			ReportData->Button |= pen;
+			// Every step is a HAT report then a neutral one, diagonal when it moves along both axes.
+			if (plan_left % 2)
+			{
+				int ax = abs(plan_command.A);
+				int ay = abs(plan_command.B);
+				int n = max(ax, ay);
+				int step = max(plan_x, plan_y) + 1;
+				// Bresenham: after step k of n the pen is at k / n of the line, rounded.
+				bool along_x = (2 * step * ax + n) / (2 * n) > plan_x;
+				bool along_y = (2 * step * ay + n) / (2 * n) > plan_y;
+				if (along_x && along_y)
+					ReportData->HAT = plan_command.A > 0 ? (plan_command.B > 0 ? HAT_BOTTOM_RIGHT : HAT_TOP_RIGHT)
+						: (plan_command.B > 0 ? HAT_BOTTOM_LEFT : HAT_TOP_LEFT);
+				else if (along_x)
+					ReportData->HAT = plan_command.A > 0 ? HAT_RIGHT : HAT_LEFT;
+				else
+					ReportData->HAT = plan_command.B > 0 ? HAT_BOTTOM : HAT_TOP;
+				plan_x += along_x;
+				plan_y += along_y;
+			}
+			break;
+		case PLAN_DOT:
+			ReportData->Button |= pen;
+			break;
+		case PLAN_BRUSH:
+			if (plan_left % 2)
+				ReportData->Button |= plan_command.A > 0 ? BRUSH_BIGGER : BRUSH_SMALLER;
+			break;
+		case PLAN_SWEEP:
+			if ((uint8_t)plan_command.A & PLAN_SWEEP_PEN)
+				ReportData->Button |= pen;
+			switch ((uint8_t)plan_command.A & ~PLAN_SWEEP_PEN)
+			{
+				case PLAN_SWEEP_RIGHT:
+					ReportData->LX = STICK_MAX;
+					break;
+				case PLAN_SWEEP_LEFT:
+					ReportData->LX = STICK_MIN;
+					break;
+				case PLAN_SWEEP_DOWN:
+					ReportData->LY = STICK_MAX;
+					break;
+				case PLAN_SWEEP_HOME:
+					ReportData->LX = STICK_MIN;
+					ReportData->LY = STICK_MIN;
+					break;
+			}
+			break;
+	}
+	return false;
+}
+
+// Start over from the controller pairing after the USB connection dropped, as the console may
+// have moved or reset the cursor meanwhile, and keep what was printed so far.
+static void Resume(void)
+{
+	switch (state)
+	{
+		case STOP_X:
+		case STOP_Y:
+		case MOVE_X:
+		case MOVE_Y:
+			// The current row is uncertain, the ones above it are done.
+			resume = RESUME_ROW;
+			resume_row = ypos;
+			break;
+		case PLAN:
+			// Unless it was already the way back to a row.
+			if (resume == RESUME_NONE)
+				resume = RESUME_PLAN;
+			break;
+		case DONE:
+			return;
+		default:
+			// Still syncing, go on as before.
+			break;
+	}
+	state = SYNC_CONTROLLER;
+	presses = -1;
+	holding = false;
+	// Drop what is left of the plan command under way.
+	plan_left = 0;
+#ifdef ADAPTIVE_SYNC
+	host_out_seen = false;
+	steady_reports = 0;
+	sync_start = -1;
+#endif
+#ifdef OUT_FEEDBACK
+	feedback_pending = false;
+#endif
+}
 
 // Prepare the next report for the host.
 void GetNextReport(USB_JoystickReport_Input_t* const ReportData)
 {
+	report_seq++;
+
+	// Time since the last IN report in timer ticks, from the wide clock so that a stalled host reads
+	// as the longest interval rather than wrapping with the 16-bit counter.
+	uint32_t now = Timer_Micros();
+	uint32_t elapsed_us = now - last_report_us;
+	last_report_us = now;
+	uint16_t interval = elapsed_us < 0xFFFF / TIMER_TICKS_PER_US ? elapsed_us * TIMER_TICKS_PER_US : 0xFFFF;
+
+#ifdef PROFILE
+	// The first report has nothing to be measured against.
+	if (report_seq > 1)
+		Profiler_RecordPoll(interval);
+	if (++blink_reports == PROFILE_BLINK_REPORTS)
+	{
+		blink_reports = 0;
+		PORTD = (~PORTD & RX_LED) | (PORTD & ~RX_LED);
+	}
+#endif
+
+#if defined(TELEMETRY) && defined(OUT_FEEDBACK)
+	// The report rate once per second, along with the OUT_FEEDBACK counters.
+	if (Telemetry_Report(state, interval))
+		Telemetry_Send(TELEMETRY_FEEDBACK, state, 0, feedback_acks, feedback_timeouts);
+#elif defined(TELEMETRY)
+	Telemetry_Report(state, interval);
+#endif
+
+#ifdef ADAPTIVE_SYNC
+	// Count the IN intervals within 1/8 of the previous one.
+	if ((interval > last_interval ? interval - last_interval : last_interval - interval) <= last_interval / 8)
+	{
+		if (steady_reports < SYNC_STEADY_REPORTS)
+			steady_reports++;
+	}
+	else
+	{
+		steady_reports = 0;
+	}
+	last_interval = interval;
+#endif
+
+#ifdef MACROS
+	// Run the timelines due since the last report.
+	Macro_Tick();
+#endif
+
+#ifdef FIGHTSTICK
+	// No printing, only the buttons.
+	Fightstick_GetReport(ReportData);
+	return;
+#endif
+
+	// Start over once the connection is back.
+	if (usb_dropped)
+	{
+		usb_dropped = false;
+		Resume();
+	}
 
-	// Repeat ECHOES times the last report.
-	if (echoes > 0)
+	// The last report was held long enough.
+	if (holding && Timer_Reached(Timer_Micros(), hold_until))
+		holding = false;
+
+#ifdef OUT_FEEDBACK
+	// An OUT report received after the last report went out, mirroring it, means the host has seen it: no need to repeat it.
+	if (feedback_pending && (int16_t)(host_report_seq - sent_seq) > 0
+		&& host_report.Button == last_report.Button && host_report.HAT == last_report.HAT)
+	{
+		feedback_pending = false;
+		feedback_acks++;
+		holding = false;
+	}
+	else if (feedback_pending && !holding)
+	{
+		feedback_pending = false;
+		feedback_timeouts++;
+	}
+#endif
+
+	// Repeat the last report while it is held.
+	if (holding)
 	{
 		memcpy(ReportData, &last_report, sizeof(USB_JoystickReport_Input_t));
-		echoes--;
+		trace(state, TRACE_ECHO);
 		return;
 	}
 
@@ -205,40 +634,95 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData)
 	ReportData->RY = STICK_CENTER;
 	ReportData->HAT = HAT_CENTER;
 
+#ifdef TRACE_STATES
+	State_t last_state = state;
+#endif
+
 	// States and moves management.
 	switch (state)
 	{
 		case SYNC_CONTROLLER:
-			if (command_count > ms_2_count(2000))
-			{
-				command_count = 0;
-				state = SYNC_POSITION;
-			}
-			else
+		{
+			uint32_t elapsed = StateMillis();
+#ifdef ADAPTIVE_SYNC
+			// Once the host is ready, press L+R and A a single time each with a short gap.
+			// If it is not ready by the first press of the fixed sequence, go on with the fixed sequence.
+			if (sync_start < 0 && presses == 0 && elapsed < timings.PairingMs && elapsed >= SYNC_SETTLE_MS
+				&& host_out_seen && steady_reports >= SYNC_STEADY_REPORTS)
+				sync_start = elapsed;
+			if (sync_start >= 0)
 			{
-				if (command_count == ms_2_count(500) || command_count == ms_2_count(1000))
+				if (presses == 2 && elapsed - sync_start > 2 * SYNC_GAP_MS)
 				{
-					PORTD = (~PORTD & TX_LED) | (PORTD & ~TX_LED);
-					ReportData->Button |= SWITCH_L | SWITCH_R;
+					presses = -1;
+					state = SYNC_POSITION;
 				}
-				else if (command_count == ms_2_count(1500) || command_count == ms_2_count(2000))
+				else if (presses == 0 || (presses == 1 && elapsed - sync_start >= SYNC_GAP_MS))
 				{
 					PORTD = (~PORTD & TX_LED) | (PORTD & ~TX_LED);
-					ReportData->Button |= SWITCH_A;
+					ReportData->Button |= presses == 0 ? SWITCH_L | SWITCH_R : SWITCH_A;
+					presses++;
 				}
 				else
 				{
 					PORTD = PORTD | TX_LED;
 				}
-				command_count++;
+				break;
+			}
+#endif
+			if (presses == PAIRING_PRESSES)
+			{
+				presses = -1;
+				state = SYNC_POSITION;
+			}
+			else if (elapsed >= (presses + 1UL) * timings.PairingMs)
+			{
+				PORTD = (~PORTD & TX_LED) | (PORTD & ~TX_LED);
+				ReportData->Button |= presses < 2 ? SWITCH_L | SWITCH_R : SWITCH_A;
+				presses++;
+			}
+			else
+			{
+				PORTD = PORTD | TX_LED;
 			}
 			break;
+		}
 		case SYNC_POSITION:
-			if (command_count == ms_2_count(4000))
+			if (StateMillis() >= timings.HomeMs)
 			{
-				command_count = 0;
+				if (resume == RESUME_ROW)
+				{
+					// Back to the start of the row to print again, the way it is printed, with the pen up.
+					presses = -1;
+					xpos = (resume_row % 2) ? max(Bitmap_Last(false), 0) : min(Bitmap_First(false), 320 - 1);
+					ypos = resume_row;
+					Plan_Move(xpos, ypos);
+					state = PLAN;
+					break;
+				}
+				// Hold still at the top left until the first streamed rows are in.
+				if (!Bitmap_Ready(true))
+					break;
+				presses = -1;
 				xpos = 0;
 				ypos = 0;
+				resume = RESUME_NONE;
+				// Carry out the plan of the image first, if it has one.
+				if (Bitmap_Plan())
+				{
+					pen = SWITCH_A;
+					Plan_Begin(Bitmap_Plan());
+					state = PLAN;
+					break;
+				}
+				// Nothing to print, such as an update to an identical post.
+				if (Bitmap_Flags() & IMAGE_NO_RASTER)
+				{
+					state = DONE;
+					break;
+				}
+				pen = (Bitmap_Flags() & IMAGE_ERASE) ? SWITCH_B : SWITCH_A;
+				Bitmap_Begin();
 				state = STOP_X;
 			}
 			else
@@ -246,20 +730,40 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData)
 				// Moving faster with LX/LY.
 				ReportData->LX = STICK_MIN;
 				ReportData->LY = STICK_MIN;
-				// Clear the screen.
-				if (command_count == ms_2_count(1500) || command_count == ms_2_count(3000))
+				// Clear the screen, unless the image only updates what is on it, or printing resumes.
+				// Then the brush is made the smallest instead, as it is when the canvas is cleared.
+				// Both presses are timings.ClearMs apart.
+				bool due = presses < 2 && StateMillis() >= (presses + 1UL) * timings.ClearMs;
+				if (due)
+					presses++;
+				if (due && !(Bitmap_Flags() & IMAGE_KEEP) && resume == RESUME_NONE)
 				{
 					PORTD = (~PORTD & TX_LED) | (PORTD & ~TX_LED);
 					ReportData->Button |= SWITCH_LCLICK;
 				}
+				else if (due && resume != RESUME_NONE)
+				{
+					PORTD = (~PORTD & TX_LED) | (PORTD & ~TX_LED);
+					ReportData->Button |= BRUSH_SMALLER;
+				}
 				else
 				{
 					PORTD = PORTD | TX_LED;
 				}
-				command_count++;
 			}
 			break;
 		case STOP_X:
+#ifdef SKIP_BLANKS
+			// Go down as soon as the rest of this row and the part of the next row the way back won't cover are both blank.
+			if ((ypos % 2) ? xpos <= min(Bitmap_First(false), Bitmap_First(true)) : xpos >= max(Bitmap_Last(false), Bitmap_Last(true)))
+			{
+				if (ypos < 120 - 1)
+					state = MOVE_Y;
+				else
+					state = DONE;
+				break;
+			}
+#endif
 			state = MOVE_X;
 			break;
 		case STOP_Y:
@@ -274,11 +778,13 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData)
 			{
 				ReportData->HAT = HAT_LEFT;
 				xpos--;
+				Bitmap_Left();
 			}
 			else
 			{
 				ReportData->HAT = HAT_RIGHT;
 				xpos++;
+				Bitmap_Right();
 			}
 			if (xpos > 0 && xpos < 320 - 1)
 				state = STOP_X;
@@ -286,21 +792,225 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData)
 				state = STOP_Y;
 			break;
 		case MOVE_Y:
+			// Hold still, without inking, until the next streamed row is in.
+			if (!Bitmap_Ready(false))
+			{
+				trace(state, TRACE_ECHO);
+				return;
+			}
 			PORTD = (~PORTD & TX_LED) | (PORTD & ~TX_LED);
 			ReportData->HAT = HAT_BOTTOM;
 			ypos++;
+			Bitmap_NextRow();
 			state = STOP_X;
 			break;
 		case DONE:
+			trace(state, TRACE_ECHO);
 			return;
+		case PLAN:
+			PORTD = (~PORTD & TX_LED) | (PORTD & ~TX_LED);
+			if (PlanStep(ReportData))
+			{
+				// Back at the row to print again, on its first pixel to ink, or at the end of it if it is blank.
+				if (resume == RESUME_ROW)
+				{
+					resume = RESUME_NONE;
+					Bitmap_Seek(xpos);
+					state = ((ypos % 2) ? xpos > 0 : xpos < 320 - 1) ? STOP_X : STOP_Y;
+					break;
+				}
+				// Plans that leave pixels to the row by row pass end at the top left corner.
+				if (Bitmap_Flags() & IMAGE_NO_RASTER)
+				{
+					state = DONE;
+					break;
+				}
+				pen = (Bitmap_Flags() & IMAGE_ERASE) ? SWITCH_B : SWITCH_A;
+				Bitmap_Begin();
+				state = STOP_X;
+			}
+			break;
 	}
 
-	// Inking
-	if (state != SYNC_CONTROLLER && state != SYNC_POSITION)
-		if (is_black(xpos, ypos))
-			ReportData->Button |= SWITCH_A;
+	// Inking, or erasing
+	if (state != SYNC_CONTROLLER && state != SYNC_POSITION && state != PLAN && state != DONE)
+		if (Bitmap_Ink())
+			ReportData->Button |= pen;
+
+	trace(state, (ReportData->Button & (SWITCH_A | SWITCH_B)) ? TRACE_INK : (state != last_state) ? TRACE_ENTER : TRACE_MOVE);
+
+#ifdef TELEMETRY
+	if (state != telemetry_state)
+	{
+		Telemetry_Send(TELEMETRY_STATE, state, telemetry_state, xpos, ypos);
+		telemetry_state = state;
+	}
+#endif
 
 	// Prepare to echo this report.
 	memcpy(&last_report, ReportData, sizeof(USB_JoystickReport_Input_t));
-	echoes = ECHOES;
+	holding = true;
+	hold_until = Timer_Micros() + HOLD_US;
+#ifdef OUT_FEEDBACK
+	// Sync and plan steps rely on being held their full time, so only printing reports may be cut short.
+	sent_seq = report_seq;
+	feedback_pending = (state != SYNC_CONTROLLER && state != SYNC_POSITION && state != PLAN);
+#endif
+}
+
+// Whether timings can be taken from the host. Both canvas clear presses must come before the cursor is home,
+// and a field of all ones would read back from EEPROM as never saved.
+static bool ValidTimings(const Timings_t* const t)
+{
+	return t->Echoes < 0xFF && t->PairingMs > 0 && t->PairingMs < 0xFFFF && t->ClearMs < 0xFFFF
+		&& 2UL * t->ClearMs < t->HomeMs && t->HomeMs < 0xFFFF;
+}
+
+// Process control requests sent to the device from the USB host: the feature reports, and the CDC requests of the telemetry.
+void EVENT_USB_Device_ControlRequest(void)
+{
+#ifdef TELEMETRY
+	Telemetry_ControlRequest();
+#endif
+	if ((USB_ControlRequest.wValue >> 8) != HID_REPORT_ITEM_Feature || USB_ControlRequest.wIndex != INTERFACE_ID_Joystick)
+		return;
+
+	uint8_t id = USB_ControlRequest.wValue & 0xFF;
+	// The report ID, then the report.
+	struct {
+		uint8_t ID;
+		union {
+			Progress_t Progress;
+			PollStats_t Poll;
+			LatencyStats_t Latency;
+			PipelineStats_t Pipeline;
+			Timings_t Timings;
+			uint8_t Image;
+		};
+	} report;
+	uint8_t size;
+
+	switch (USB_ControlRequest.bRequest)
+	{
+		case HID_REQ_GetReport:
+			if (USB_ControlRequest.bmRequestType != (REQDIR_DEVICETOHOST | REQTYPE_CLASS | REQREC_INTERFACE))
+				return;
+			switch (id)
+			{
+				case FEATURE_PROGRESS:
+					report.Progress.State = state;
+					report.Progress.X = xpos;
+					report.Progress.Y = ypos;
+					report.Progress.Reports = report_seq;
+					report.Progress.Millis = Timer_Millis();
+#ifdef OUT_FEEDBACK
+					report.Progress.FeedbackAcks = feedback_acks;
+					report.Progress.FeedbackTimeouts = feedback_timeouts;
+#else
+					report.Progress.FeedbackAcks = 0;
+					report.Progress.FeedbackTimeouts = 0;
+#endif
+					size = sizeof(Progress_t);
+					break;
+				case FEATURE_POLL:
+					report.Poll = poll_stats;
+					size = sizeof(PollStats_t);
+					break;
+				case FEATURE_LATENCY:
+					report.Latency = latency_stats;
+					size = sizeof(LatencyStats_t);
+					break;
+				case FEATURE_PIPELINE:
+					report.Pipeline = pipeline_stats;
+					size = sizeof(PipelineStats_t);
+					break;
+				case FEATURE_TIMINGS:
+					report.Timings = timings;
+					size = sizeof(Timings_t);
+					break;
+				case FEATURE_IMAGE:
+					report.Image = Settings_ImageIndex();
+					size = 1;
+					break;
+				default:
+					// Left unhandled, the request gets stalled.
+					return;
+			}
+			report.ID = id;
+			Endpoint_ClearSETUP();
+			// Cut to the length the host asked for.
+			Endpoint_Write_Control_Stream_LE(&report, 1 + size);
+			Endpoint_ClearOUT();
+			break;
+		case HID_REQ_SetReport:
+			if (USB_ControlRequest.bmRequestType != (REQDIR_HOSTTODEVICE | REQTYPE_CLASS | REQREC_INTERFACE))
+				return;
+			switch (id)
+			{
+				case FEATURE_POLL:
+					size = 0;
+					break;
+				case FEATURE_TIMINGS:
+					size = sizeof(Timings_t);
+					break;
+				case FEATURE_IMAGE:
+					size = 1;
+					break;
+				default:
+					return;
+			}
+			if (USB_ControlRequest.wLength != 1 + size)
+				return;
+			Endpoint_ClearSETUP();
+			Endpoint_Read_Control_Stream_LE(&report, 1 + size);
+			Endpoint_ClearIN();
+			switch (id)
+			{
+				case FEATURE_POLL:
+					Profiler_Reset();
+					break;
+				case FEATURE_TIMINGS:
+					if (ValidTimings(&report.Timings))
+					{
+						timings = report.Timings;
+						Settings_SetTimings(&timings);
+					}
+					break;
+				case FEATURE_IMAGE:
+					if (report.Image != 0xFF)
+						Settings_SetImageIndex(report.Image);
+					break;
+			}
+			break;
+	}
+}
+
+#ifdef TELEMETRY
+// Commands of the telemetry interface other than pause and go.
+void CALLBACK_Telemetry_Command(const uint8_t command, const uint8_t arg)
+{
+	switch (command)
+	{
+		case TELEMETRY_RESET:
+#ifdef OUT_FEEDBACK
+			feedback_acks = 0;
+			feedback_timeouts = 0;
+#endif
+			Telemetry_Send(TELEMETRY_REPLY, state, command, 0, 0);
+			break;
+		case TELEMETRY_STATUS:
+			Telemetry_Send(TELEMETRY_REPLY, state, command, xpos, ypos);
+			break;
+		case TELEMETRY_ECHOES:
+		{
+			// Checked as FEATURE_TIMINGS does, but not saved. The reply has the echoes in effect either way.
+			Timings_t wanted = timings;
+			wanted.Echoes = arg;
+			if (ValidTimings(&wanted))
+				timings = wanted;
+			Telemetry_Send(TELEMETRY_REPLY, state, command, timings.Echoes, 0);
+			break;
+		}
+	}
 }
+#endif
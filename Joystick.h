@@ -42,6 +42,7 @@
 #include <avr/power.h>
 #include <avr/interrupt.h>
 #include <avr/pgmspace.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include <LUFA/Drivers/USB/USB.h>
@@ -50,7 +51,16 @@
 #include <LUFA/Drivers/Board/Buttons.h>
 #include <LUFA/Platform/Platform.h>
 
+#include "AppConfig.h"
 #include "Descriptors.h"
+#include "Timer.h"
+#include "Profiler.h"
+#include "Macro.h"
+#include "Stick.h"
+#include "Bitmap.h"
+#include "Plan.h"
+#include "Settings.h"
+#include "Telemetry.h"
 
 // Type Defines
 // Enumeration for joystick buttons.
@@ -107,6 +117,27 @@ typedef struct {
 	uint8_t  RY;     // Right Stick Y
 } USB_JoystickReport_Output_t;
 
+// Feature reports, got and set with HID GET_REPORT and SET_REPORT requests on the control endpoint, each
+// starting with its ID. They are left out of the report descriptor, as numbering reports would change the
+// joystick reports: the Switch never asks for them, a PC reaches them through hidraw (see tune.py).
+#define FEATURE_PROGRESS 0x01 // Get: Progress_t
+#define FEATURE_POLL     0x02 // Get: PollStats_t. Set, with no data: clear all the statistics
+#define FEATURE_LATENCY  0x03 // Get: LatencyStats_t
+#define FEATURE_PIPELINE 0x04 // Get: PipelineStats_t
+#define FEATURE_TIMINGS  0x05 // Get, set: Timings_t, saved in EEPROM and used from the next report on
+#define FEATURE_IMAGE    0x06 // Get, set: index of the image to print, saved in EEPROM for the next boots
+
+// Where the print is, for FEATURE_PROGRESS.
+typedef struct {
+	uint8_t  State;            // Printer state
+	uint16_t X;                // Cursor position
+	uint16_t Y;
+	uint16_t Reports;          // IN reports prepared, wrapping
+	uint32_t Millis;           // Time since boot
+	uint16_t FeedbackAcks;     // Reports acknowledged by the host, with OUT_FEEDBACK
+	uint16_t FeedbackTimeouts; // Reports whose hold ran out without it, with OUT_FEEDBACK
+} Progress_t;
+
 // Function Prototypes
 // Setup all necessary hardware, including USB initialization.
 void SetupHardware(void);
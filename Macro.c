@@ -0,0 +1,180 @@
+/** \file
+ *
+ *  Concurrent timed button timelines on a hashed timer wheel. Every timeline sits in the
+ *  list of the wheel slot it is due in, so a tick only looks at the timelines of one slot
+ *  and the cost per report doesn't grow with the number of running timelines.
+ */
+
+#include "Macro.h"
+
+// Timeline kinds.
+enum {
+	TIMELINE_FREE,     // Unused and in no slot
+	TIMELINE_STOPPED,  // Stopped, still in a slot until the wheel gets to it
+	TIMELINE_TURBO,    // Toggling its buttons
+	TIMELINE_HOLD,     // Holding its buttons until due
+};
+
+typedef struct {
+	uint16_t Buttons;  // Buttons driven by this timeline
+	uint16_t Period;   // Wheel ticks between two toggles of a turbo
+	uint16_t Rounds;   // Wheel turns left before it is due, up to 65535 / MACRO_SLOTS
+	uint8_t  Next;     // Next timeline in the same slot
+	uint8_t  Kind;
+	bool     Pressed;  // Whether Buttons are currently pressed by this timeline
+} Timeline_t;
+
+static Timeline_t timelines[MACRO_TIMELINES];
+// First timeline of each slot.
+static uint8_t slots[MACRO_SLOTS] = {[0 ... MACRO_SLOTS - 1] = MACRO_NONE};
+static uint8_t current_slot = 0;
+// Timer_Millis clock at the last tick, and timelines in the slots. The clock is only followed tick
+// by tick while some timeline is in a slot.
+static uint32_t seen_ms = 0;
+static uint8_t active = 0;
+
+// Number of timelines pressing each button, and the resulting buttons.
+static uint8_t presses[16];
+static uint16_t pressed = 0;
+
+static void Press(const uint16_t buttons)
+{
+	for (uint8_t i = 0; i < 16; i++)
+		if (buttons & (1U << i) && presses[i]++ == 0)
+			pressed |= 1U << i;
+}
+
+static void Release(const uint16_t buttons)
+{
+	for (uint8_t i = 0; i < 16; i++)
+		if (buttons & (1U << i) && --presses[i] == 0)
+			pressed &= ~(1U << i);
+}
+
+// Put a timeline in the slot it is due in, delay ticks from now.
+static void Schedule(const uint8_t handle, uint16_t delay)
+{
+	if (delay == 0)
+		delay = 1;
+	uint8_t slot = (current_slot + delay) & (MACRO_SLOTS - 1);
+	timelines[handle].Rounds = (delay - 1) / MACRO_SLOTS;
+	timelines[handle].Next = slots[slot];
+	slots[slot] = handle;
+}
+
+static uint8_t Start(const uint8_t kind, const uint16_t buttons)
+{
+	for (uint8_t handle = 0; handle < MACRO_TIMELINES; handle++)
+	{
+		if (timelines[handle].Kind == TIMELINE_FREE)
+		{
+			// Arm the wheel from now, not from the last timeline.
+			if (active++ == 0)
+				seen_ms = Timer_Millis();
+			timelines[handle].Kind = kind;
+			timelines[handle].Buttons = buttons;
+			timelines[handle].Pressed = true;
+			Press(buttons);
+			return handle;
+		}
+	}
+	return MACRO_NONE;
+}
+
+// Toggle buttons every period_ms / 2 until stopped, starting pressed. Returns a handle or MACRO_NONE.
+uint8_t Macro_Turbo(const uint16_t buttons, const uint16_t period_ms)
+{
+	uint8_t handle = Start(TIMELINE_TURBO, buttons);
+	if (handle != MACRO_NONE)
+	{
+		timelines[handle].Period = period_ms / 2;
+		Schedule(handle, period_ms / 2);
+	}
+	return handle;
+}
+
+// Press buttons now and release them after duration_ms. Returns a handle or MACRO_NONE.
+uint8_t Macro_Hold(const uint16_t buttons, const uint16_t duration_ms)
+{
+	uint8_t handle = Start(TIMELINE_HOLD, buttons);
+	if (handle != MACRO_NONE)
+		Schedule(handle, duration_ms);
+	return handle;
+}
+
+// Stop a timeline and release its buttons.
+void Macro_Stop(const uint8_t handle)
+{
+	if (handle >= MACRO_TIMELINES || timelines[handle].Kind == TIMELINE_FREE || timelines[handle].Kind == TIMELINE_STOPPED)
+		return;
+	if (timelines[handle].Pressed)
+		Release(timelines[handle].Buttons);
+	timelines[handle].Pressed = false;
+	timelines[handle].Kind = TIMELINE_STOPPED;
+}
+
+// Advance the wheel by one tick and run what is due.
+static void Advance(void)
+{
+	current_slot = (current_slot + 1) & (MACRO_SLOTS - 1);
+
+	// Take the whole slot, the timelines not due yet go back in it.
+	uint8_t handle = slots[current_slot];
+	slots[current_slot] = MACRO_NONE;
+	while (handle != MACRO_NONE)
+	{
+		Timeline_t* timeline = &timelines[handle];
+		uint8_t next = timeline->Next;
+
+		if (timeline->Kind != TIMELINE_STOPPED && timeline->Rounds > 0)
+		{
+			timeline->Rounds--;
+			timeline->Next = slots[current_slot];
+			slots[current_slot] = handle;
+		}
+		else
+		{
+			switch (timeline->Kind)
+			{
+				case TIMELINE_TURBO:
+					if (timeline->Pressed)
+						Release(timeline->Buttons);
+					else
+						Press(timeline->Buttons);
+					timeline->Pressed = !timeline->Pressed;
+					Schedule(handle, timeline->Period);
+					break;
+				case TIMELINE_HOLD:
+					Release(timeline->Buttons);
+					timeline->Pressed = false;
+					timeline->Kind = TIMELINE_FREE;
+					active--;
+					break;
+				default:
+					timeline->Kind = TIMELINE_FREE;
+					active--;
+					break;
+			}
+		}
+		handle = next;
+	}
+}
+
+// Run the timelines due in the milliseconds since the last call.
+void Macro_Tick(void)
+{
+	uint32_t now = Timer_Millis();
+	// One wheel tick per millisecond while timelines are pending, then straight to now once none are.
+	while (active > 0 && seen_ms != now)
+	{
+		seen_ms++;
+		Advance();
+	}
+	seen_ms = now;
+}
+
+// Buttons currently pressed by the timelines.
+uint16_t Macro_Buttons(void)
+{
+	return pressed;
+}
@@ -0,0 +1,35 @@
+/** \file
+ *
+ *  Header file for Macro.c.
+ */
+
+#ifndef _MACRO_H_
+#define _MACRO_H_
+
+// Includes
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "Timer.h"
+
+// Macros
+// Wheel slots, one per millisecond of the Timer_Millis clock. Delays longer than this take extra turns of the wheel.
+#define MACRO_SLOTS 32
+// Timelines that can run at the same time.
+#define MACRO_TIMELINES 8
+// Handle of no timeline.
+#define MACRO_NONE 0xFF
+
+// Function Prototypes
+// Toggle buttons every period_ms / 2 until stopped, starting pressed. Returns a handle or MACRO_NONE.
+uint8_t Macro_Turbo(const uint16_t buttons, const uint16_t period_ms);
+// Press buttons now and release them after duration_ms. Returns a handle or MACRO_NONE.
+uint8_t Macro_Hold(const uint16_t buttons, const uint16_t duration_ms);
+// Stop a timeline and release its buttons.
+void Macro_Stop(const uint8_t handle);
+// Run the timelines due in the milliseconds since the last call.
+void Macro_Tick(void);
+// Buttons currently pressed by the timelines.
+uint16_t Macro_Buttons(void);
+
+#endif
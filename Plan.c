@@ -0,0 +1,230 @@
+/** \file
+ *
+ *  Plans made by planner.py: lists of pen moves, strokes and brush changes printed before,
+ *  or instead of, the row by row pass over the image. The commands are read one at a time
+ *  from flash, and carried out by the PLAN state of Joystick.c.
+ *
+ *  A PLAN_TEXT command is expanded here into the moves, dots and lines writing its text, one glyph
+ *  column at a time: every vertical run of pixels of a column is a block scale pixels wide, drawn
+ *  as vertical lines going down and up in turn. planner.py expands it the same way.
+ */
+
+#include "Plan.h"
+
+// Steps writing a block of a glyph.
+typedef enum {
+	TEXT_NONE,  // Not writing text
+	TEXT_SCAN,  // Find the next block
+	TEXT_GOTO,  // Move to its top left corner
+	TEXT_DOT,   // Press the pen there
+	TEXT_DOWN,  // Go down, or up, one of its lines
+	TEXT_SIDE,  // Go right to the next one of its lines
+} TextStep_t;
+
+// Read position in the plan, NULL for a single move.
+static const uint8_t* next;
+// Move left to do, see Plan_Move.
+static int16_t move_x, move_y;
+
+// Text being written: its next character, characters left and scale, the glyph column being
+// scanned, and where the pen, the next character, the current glyph and the next block are,
+// relative to where the text started.
+static TextStep_t text_step = TEXT_NONE;
+static const uint8_t* text;
+static uint8_t text_left;
+static uint8_t text_scale;
+static char character;
+static uint8_t column;
+static uint8_t column_bits;
+static uint8_t row;
+static int16_t pen_x, pen_y;
+static int16_t cursor_x, cursor_y;
+static int16_t glyph_x, glyph_y;
+static int16_t block_x, block_y;
+static uint8_t block_height;
+static uint8_t block_lines;
+
+// Longest part of a move along one axis that fits in a command.
+static int8_t MovePart(const int16_t d)
+{
+	return d > 127 ? 127 : d < -127 ? -127 : d;
+}
+
+// Start writing length characters from text at the pen, scale times bigger than the font.
+static void TextBegin(const uint8_t* const characters, const uint8_t length, const uint8_t scale)
+{
+	text = characters;
+	text_left = length;
+	text_scale = scale;
+	pen_x = pen_y = 0;
+	cursor_x = cursor_y = 0;
+	// As if at the end of a glyph, to load the first character.
+	column = FONT_WIDTH - 1;
+	column_bits = 0;
+	row = FONT_HEIGHT;
+	text_step = TEXT_SCAN;
+}
+
+// Next command writing the text, false once it is written.
+static bool TextFetch(PlanCommand_t* const command)
+{
+	command->A = 0;
+	command->B = 0;
+	while (true)
+	{
+		switch (text_step)
+		{
+			case TEXT_SCAN:
+				while (row < FONT_HEIGHT && !(column_bits >> row & 1))
+					row++;
+				if (row == FONT_HEIGHT)
+				{
+					// Next column of the glyph, or next character.
+					row = 0;
+					if (column + 1 < FONT_WIDTH)
+					{
+						column_bits = Font_Column(character, ++column);
+						break;
+					}
+					if (text_left == 0)
+						return false;
+					character = pgm_read_byte(text++);
+					text_left--;
+					column = 0;
+					if (character == '\n')
+					{
+						cursor_x = 0;
+						cursor_y += FONT_LINE * text_scale;
+						column = FONT_WIDTH - 1;
+						column_bits = 0;
+						break;
+					}
+					glyph_x = cursor_x;
+					glyph_y = cursor_y;
+					cursor_x += FONT_ADVANCE * text_scale;
+					column_bits = Font_Column(character, 0);
+					break;
+				}
+				block_x = glyph_x + column * text_scale;
+				block_y = glyph_y + row * text_scale;
+				block_height = 0;
+				while (row < FONT_HEIGHT && (column_bits >> row & 1))
+				{
+					block_height += text_scale;
+					row++;
+				}
+				block_lines = 0;
+				text_step = TEXT_GOTO;
+				break;
+			case TEXT_GOTO:
+				if (block_x == pen_x && block_y == pen_y)
+				{
+					text_step = TEXT_DOT;
+					break;
+				}
+				// Moves longer than a command are split.
+				command->Op = PLAN_MOVE;
+				command->A = MovePart(block_x - pen_x);
+				command->B = MovePart(block_y - pen_y);
+				pen_x += command->A;
+				pen_y += command->B;
+				return true;
+			case TEXT_DOT:
+				command->Op = PLAN_DOT;
+				text_step = TEXT_DOWN;
+				return true;
+			case TEXT_DOWN:
+				block_lines++;
+				text_step = block_lines < text_scale ? TEXT_SIDE : TEXT_SCAN;
+				if (block_height > 1)
+				{
+					command->Op = PLAN_LINE;
+					command->B = (block_lines % 2) ? block_height - 1 : -(block_height - 1);
+					pen_y += command->B;
+					return true;
+				}
+				break;
+			case TEXT_SIDE:
+				command->Op = PLAN_LINE;
+				command->A = 1;
+				pen_x++;
+				text_step = TEXT_DOWN;
+				return true;
+			default:
+				return false;
+		}
+	}
+}
+
+// Start reading a plan from flash.
+void Plan_Begin(const uint8_t* const plan)
+{
+	next = plan;
+	text_step = TEXT_NONE;
+	move_x = move_y = 0;
+}
+
+// Start a plan of a single move with the pen up, such as the way back to a row after a reconnect.
+void Plan_Move(const int16_t dx, const int16_t dy)
+{
+	next = NULL;
+	text_step = TEXT_NONE;
+	move_x = dx;
+	move_y = dy;
+}
+
+// Read the next command, false at the end of the plan.
+bool Plan_Fetch(PlanCommand_t* const command)
+{
+	if (text_step != TEXT_NONE)
+	{
+		if (TextFetch(command))
+			return true;
+		text_step = TEXT_NONE;
+	}
+
+	if (move_x || move_y)
+	{
+		command->Op = PLAN_MOVE;
+		command->A = MovePart(move_x);
+		command->B = MovePart(move_y);
+		move_x -= command->A;
+		move_y -= command->B;
+		return true;
+	}
+	if (!next)
+		return false;
+
+	command->Op = pgm_read_byte(next++);
+	command->A = 0;
+	command->B = 0;
+	switch (command->Op)
+	{
+		case PLAN_MOVE:
+		case PLAN_LINE:
+		case PLAN_SWEEP:
+		case PLAN_STROKE:
+			command->A = pgm_read_byte(next++);
+			command->B = pgm_read_byte(next++);
+			break;
+		case PLAN_BRUSH:
+		case PLAN_PEN:
+			command->A = pgm_read_byte(next++);
+			break;
+		case PLAN_DOT:
+			break;
+		case PLAN_TEXT:
+		{
+			uint8_t scale = pgm_read_byte(next++);
+			uint8_t length = pgm_read_byte(next++);
+			TextBegin(next, length, scale);
+			next += length;
+			return Plan_Fetch(command);
+		}
+		default:
+			// PLAN_END, or garbage: stay on it.
+			next--;
+			return false;
+	}
+	return true;
+}
@@ -0,0 +1,51 @@
+/** \file
+ *
+ *  Header file for Plan.c.
+ */
+
+#ifndef _PLAN_H_
+#define _PLAN_H_
+
+// Includes
+#include <avr/pgmspace.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "Font.h"
+
+// Macros
+// Plan opcodes, each followed by its operands. Must match planner.py.
+#define PLAN_END    0x00 // End of the plan
+#define PLAN_MOVE   0x01 // dx, dy (signed): move with the pen up, along X then along Y
+#define PLAN_LINE   0x02 // dx, dy (signed): move holding the pen, along the line to dx, dy
+#define PLAN_DOT    0x03 // Press the pen here
+#define PLAN_BRUSH  0x04 // n (signed): make the brush n sizes bigger, or -n sizes smaller
+#define PLAN_PEN    0x05 // button: 0 to ink with A, 1 to erase with B
+#define PLAN_SWEEP  0x06 // direction, units: hold the stick that way for units * 16 ms
+#define PLAN_STROKE 0x07 // dx, dy (signed): move holding the pen along the line to dx, dy, diagonals included
+#define PLAN_TEXT   0x08 // scale, length, characters: write the text from here in the font of Font.h, scale times bigger
+
+// Sweep directions, or'ed with PLAN_SWEEP_PEN to hold the pen meanwhile.
+#define PLAN_SWEEP_RIGHT 0
+#define PLAN_SWEEP_LEFT  1
+#define PLAN_SWEEP_DOWN  2
+#define PLAN_SWEEP_HOME  3 // Up and left, to the top left corner
+#define PLAN_SWEEP_PEN   0x80
+
+// Type Defines
+// A plan command with its operands.
+typedef struct {
+	uint8_t Op;
+	int8_t A;
+	int8_t B;
+} PlanCommand_t;
+
+// Function Prototypes
+// Start reading a plan from flash.
+void Plan_Begin(const uint8_t* const plan);
+// Start a plan of a single move with the pen up, such as the way back to a row after a reconnect.
+void Plan_Move(const int16_t dx, const int16_t dy);
+// Read the next command, false at the end of the plan.
+bool Plan_Fetch(PlanCommand_t* const command);
+
+#endif
@@ -0,0 +1,88 @@
+/** \file
+ *
+ *  Runtime statistics about the host, kept in RAM for later readout.
+ */
+
+#include "Profiler.h"
+
+PollStats_t poll_stats;
+LatencyStats_t latency_stats;
+PipelineStats_t pipeline_stats;
+
+// Clear all the statistics.
+void Profiler_Reset(void)
+{
+	poll_stats.Reports = 0;
+	poll_stats.SumTicks = 0;
+	poll_stats.MinTicks = 0xFFFF;
+	poll_stats.MaxTicks = 0;
+	for (uint8_t i = 0; i < PROFILER_BUCKETS; i++)
+		poll_stats.Histogram[i] = 0;
+
+	latency_stats.Samples = 0;
+	latency_stats.SumTicks = 0;
+	latency_stats.MaxTicks = 0;
+
+	for (uint8_t i = 0; i < PROFILER_STAGES; i++)
+	{
+		pipeline_stats.Runs[i] = 0;
+		pipeline_stats.SumTicks[i] = 0;
+		pipeline_stats.MaxTicks[i] = 0;
+	}
+}
+
+// Record the time between two IN reports, in timer ticks.
+void Profiler_RecordPoll(const uint16_t ticks)
+{
+	// Keep the mean right while making room for more intervals.
+	if (poll_stats.SumTicks & 0x80000000)
+	{
+		poll_stats.SumTicks >>= 1;
+		poll_stats.Reports >>= 1;
+	}
+	poll_stats.SumTicks += ticks;
+	poll_stats.Reports++;
+
+	if (ticks < poll_stats.MinTicks)
+		poll_stats.MinTicks = ticks;
+	if (ticks > poll_stats.MaxTicks)
+		poll_stats.MaxTicks = ticks;
+
+	uint16_t bucket = ticks / TIMER_TICKS_PER_MS;
+	if (bucket >= PROFILER_BUCKETS)
+		bucket = PROFILER_BUCKETS - 1;
+	if (poll_stats.Histogram[bucket] == 0xFFFF)
+		for (uint8_t i = 0; i < PROFILER_BUCKETS; i++)
+			poll_stats.Histogram[i] >>= 1;
+	poll_stats.Histogram[bucket]++;
+}
+
+// Record the time from an input change to the report carrying it being sent, in timer ticks.
+void Profiler_RecordLatency(const uint16_t ticks)
+{
+	if (latency_stats.SumTicks & 0x80000000)
+	{
+		latency_stats.SumTicks >>= 1;
+		latency_stats.Samples >>= 1;
+	}
+	latency_stats.SumTicks += ticks;
+	latency_stats.Samples++;
+
+	if (ticks > latency_stats.MaxTicks)
+		latency_stats.MaxTicks = ticks;
+}
+
+// Record the time a pipeline stage took, in timer ticks.
+void Profiler_RecordStage(const uint8_t stage, const uint16_t ticks)
+{
+	if (pipeline_stats.Runs[stage] == 0xFFFF)
+	{
+		pipeline_stats.SumTicks[stage] >>= 1;
+		pipeline_stats.Runs[stage] >>= 1;
+	}
+	pipeline_stats.SumTicks[stage] += ticks;
+	pipeline_stats.Runs[stage]++;
+
+	if (ticks > pipeline_stats.MaxTicks[stage])
+		pipeline_stats.MaxTicks[stage] = ticks;
+}
@@ -0,0 +1,59 @@
+/** \file
+ *
+ *  Header file for Profiler.c.
+ */
+
+#ifndef _PROFILER_H_
+#define _PROFILER_H_
+
+// Includes
+#include <stdint.h>
+
+#include "Timer.h"
+
+// Macros
+// Number of 1 ms wide histogram buckets for the IN intervals, the last one counts everything longer.
+#define PROFILER_BUCKETS 16
+// Number of timed stages in the input pipeline.
+#define PROFILER_STAGES 5
+
+// Type Defines
+// Statistics of the time between two IN reports, i.e. the rate the host actually polls at.
+typedef struct {
+	uint32_t Reports;                       // Intervals recorded
+	uint32_t SumTicks;                      // Sum of the recorded intervals, Reports and SumTicks get halved together before overflowing
+	uint16_t MinTicks;                      // Shortest interval
+	uint16_t MaxTicks;                      // Longest interval
+	uint16_t Histogram[PROFILER_BUCKETS];   // Intervals per ms, all buckets get halved before one overflows
+} PollStats_t;
+
+// Time from an input change to the IN report carrying it being handed to the USB controller.
+typedef struct {
+	uint32_t Samples;                       // Latencies recorded
+	uint32_t SumTicks;                      // Sum of the recorded latencies, Samples and SumTicks get halved together before overflowing
+	uint16_t MaxTicks;                      // Longest latency
+} LatencyStats_t;
+
+// Time spent in each stage of the input pipeline.
+typedef struct {
+	uint16_t Runs[PROFILER_STAGES];         // Times each stage ran, Runs and SumTicks get halved together before overflowing
+	uint32_t SumTicks[PROFILER_STAGES];     // Sum of the stage times
+	uint16_t MaxTicks[PROFILER_STAGES];     // Longest stage time
+} PipelineStats_t;
+
+// Global Variables
+extern PollStats_t poll_stats;
+extern LatencyStats_t latency_stats;
+extern PipelineStats_t pipeline_stats;
+
+// Function Prototypes
+// Clear all the statistics.
+void Profiler_Reset(void);
+// Record the time between two IN reports, in timer ticks.
+void Profiler_RecordPoll(const uint16_t ticks);
+// Record the time from an input change to the report carrying it being sent, in timer ticks.
+void Profiler_RecordLatency(const uint16_t ticks);
+// Record the time a pipeline stage took, in timer ticks.
+void Profiler_RecordStage(const uint8_t stage, const uint16_t ticks);
+
+#endif
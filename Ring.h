@@ -0,0 +1,104 @@
+/** \file
+ *
+ *  Lock-free single producer, single consumer ring buffers, to hand data from an ISR to the
+ *  main loop (or back) without disabling interrupts around multi-byte copies.
+ *
+ *  Head is only written by the producer and Tail only by the consumer. Both are 8-bit free
+ *  running counters, so reading or writing them is atomic on the AVR, and their difference is
+ *  the fill level. Items are copied before Head moves forward, and read before Tail does.
+ */
+
+#ifndef _RING_H_
+#define _RING_H_
+
+// Includes
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Macros
+// Keep the compiler (and the CPU, off the AVR) from moving item accesses across an index update.
+#if defined(__AVR__)
+	#define RING_BARRIER() __asm__ __volatile__ ("" ::: "memory")
+#else
+	#define RING_BARRIER() __sync_synchronize()
+#endif
+
+// Define the name##_t ring type of size items of type, and its functions:
+//   name##_Push(ring, &item)  producer side, false when full
+//   name##_Pop(ring, &item)   consumer side, false when empty
+//   name##_Count(ring)        items waiting, exact on the consumer side, a lower bound on the producer side
+// and their zero-copy forms, which work on the items in place:
+//   name##_Reserve(ring)      producer side, the next free item to fill, NULL when full
+//   name##_Commit(ring)       producer side, hands the reserved item to the consumer
+//   name##_Peek(ring)         consumer side, the oldest item, NULL when empty
+//   name##_Release(ring)      consumer side, frees the peeked item
+// size must be a power of two, no more than 128. A zero-filled ring is empty.
+#define RING_DEFINE(name, type, size)                                             \
+	typedef struct {                                                              \
+		volatile uint8_t Head;                                                    \
+		volatile uint8_t Tail;                                                    \
+		type Items[size];                                                         \
+	} name##_t;                                                                   \
+	                                                                              \
+	_Static_assert((size) > 0 && (size) <= 128 && ((size) & ((size) - 1)) == 0,  \
+		#name " size must be a power of two, no more than 128");                  \
+	                                                                              \
+	static inline uint8_t name##_Count(name##_t* const ring)                      \
+	{                                                                             \
+		return (uint8_t)(ring->Head - ring->Tail);                                \
+	}                                                                             \
+	                                                                              \
+	static inline bool name##_Push(name##_t* const ring, const type* const item)  \
+	{                                                                             \
+		uint8_t head = ring->Head;                                                \
+		if ((uint8_t)(head - ring->Tail) == (size))                               \
+			return false;                                                         \
+		ring->Items[head & ((size) - 1)] = *item;                                 \
+		RING_BARRIER();                                                           \
+		ring->Head = head + 1;                                                    \
+		return true;                                                              \
+	}                                                                             \
+	                                                                              \
+	static inline bool name##_Pop(name##_t* const ring, type* const item)         \
+	{                                                                             \
+		uint8_t tail = ring->Tail;                                                \
+		if (ring->Head == tail)                                                   \
+			return false;                                                         \
+		RING_BARRIER();                                                           \
+		*item = ring->Items[tail & ((size) - 1)];                                 \
+		RING_BARRIER();                                                           \
+		ring->Tail = tail + 1;                                                    \
+		return true;                                                              \
+	}                                                                             \
+	                                                                              \
+	static inline type* name##_Reserve(name##_t* const ring)                      \
+	{                                                                             \
+		uint8_t head = ring->Head;                                                \
+		if ((uint8_t)(head - ring->Tail) == (size))                               \
+			return NULL;                                                          \
+		return &ring->Items[head & ((size) - 1)];                                 \
+	}                                                                             \
+	                                                                              \
+	static inline void name##_Commit(name##_t* const ring)                        \
+	{                                                                             \
+		RING_BARRIER();                                                           \
+		ring->Head = ring->Head + 1;                                              \
+	}                                                                             \
+	                                                                              \
+	static inline type* name##_Peek(name##_t* const ring)                         \
+	{                                                                             \
+		uint8_t tail = ring->Tail;                                                \
+		if (ring->Head == tail)                                                   \
+			return NULL;                                                          \
+		RING_BARRIER();                                                           \
+		return &ring->Items[tail & ((size) - 1)];                                 \
+	}                                                                             \
+	                                                                              \
+	static inline void name##_Release(name##_t* const ring)                       \
+	{                                                                             \
+		RING_BARRIER();                                                           \
+		ring->Tail = ring->Tail + 1;                                              \
+	}
+
+#endif
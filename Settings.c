@@ -0,0 +1,47 @@
+/** \file
+ *
+ *  Settings kept in EEPROM across power cycles. An erased EEPROM reads 0xFF, which
+ *  stands for the default of every setting.
+ */
+
+#include "Settings.h"
+
+// Index of the image to print.
+static uint8_t image_index EEMEM = 0xFF;
+// Printer timings.
+static Timings_t saved_timings EEMEM = {0xFF, 0xFFFF, 0xFFFF, 0xFFFF};
+
+// Index of the image to print, as last saved, 0 on a blank EEPROM.
+uint8_t Settings_ImageIndex(void)
+{
+	uint8_t index = eeprom_read_byte(&image_index);
+	return index == 0xFF ? 0 : index;
+}
+
+// Save the index of the image to print.
+void Settings_SetImageIndex(const uint8_t index)
+{
+	// Only writes when it changed, to spare the EEPROM.
+	eeprom_update_byte(&image_index, index);
+}
+
+// Load the saved timings over timings, leaving the ones never saved as they are.
+void Settings_Timings(Timings_t* const timings)
+{
+	Timings_t saved;
+	eeprom_read_block(&saved, &saved_timings, sizeof(Timings_t));
+	if (saved.Echoes != 0xFF)
+		timings->Echoes = saved.Echoes;
+	if (saved.PairingMs != 0xFFFF)
+		timings->PairingMs = saved.PairingMs;
+	if (saved.ClearMs != 0xFFFF)
+		timings->ClearMs = saved.ClearMs;
+	if (saved.HomeMs != 0xFFFF)
+		timings->HomeMs = saved.HomeMs;
+}
+
+// Save the timings.
+void Settings_SetTimings(const Timings_t* const timings)
+{
+	eeprom_update_block(timings, &saved_timings, sizeof(Timings_t));
+}
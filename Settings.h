@@ -0,0 +1,32 @@
+/** \file
+ *
+ *  Header file for Settings.c.
+ */
+
+#ifndef _SETTINGS_H_
+#define _SETTINGS_H_
+
+// Includes
+#include <avr/eeprom.h>
+#include <stdint.h>
+
+// Type Defines
+// Printer timings that can be tuned from a PC (see tune.py), little endian with no padding.
+typedef struct {
+	uint8_t  Echoes;     // Polls each report is repeated for after the first one
+	uint16_t PairingMs;  // Time before each press of the fixed pairing sequence
+	uint16_t ClearMs;    // Time before each press clearing the canvas in SYNC_POSITION
+	uint16_t HomeMs;     // Time SYNC_POSITION pushes the cursor to the top left corner
+} Timings_t;
+
+// Function Prototypes
+// Index of the image to print, as last saved, 0 on a blank EEPROM.
+uint8_t Settings_ImageIndex(void);
+// Save the index of the image to print.
+void Settings_SetImageIndex(const uint8_t index);
+// Load the saved timings over timings, leaving the ones never saved as they are.
+void Settings_Timings(Timings_t* const timings);
+// Save the timings.
+void Settings_SetTimings(const Timings_t* const timings);
+
+#endif
@@ -0,0 +1,168 @@
+/** \file
+ *
+ *  Analog stick paths in fixed point: lines, circles, spirals and eased ramps,
+ *  using a quarter-wave sine table instead of floating point.
+ */
+
+#include "Stick.h"
+
+// Path kinds.
+enum {
+	PATH_LINE,
+	PATH_CIRCLE,
+	PATH_RAMP,
+};
+
+// sin(i / 256 turn) * 255, for the first quarter of a turn.
+static const uint8_t sine[65] PROGMEM = {
+	  0,   6,  13,  19,  25,  31,  37,  44,  50,  56,  62,  68,  74,
+	 80,  86,  92,  98, 103, 109, 115, 120, 126, 131, 136, 142, 147,
+	152, 157, 162, 167, 171, 176, 180, 185, 189, 193, 197, 201, 205,
+	208, 212, 215, 219, 222, 225, 228, 231, 233, 236, 238, 240, 242,
+	244, 246, 247, 249, 250, 251, 252, 253, 254, 254, 255, 255, 255,
+};
+
+// Sine of step / 256 turn, mirrored from the quarter-wave table.
+static int16_t SinStep(const uint8_t step)
+{
+	uint8_t i = step & 63;
+	if (step & 64)
+		i = 64 - i;
+	int16_t value = pgm_read_byte(&sine[i]);
+	return (step & 128) ? -value : value;
+}
+
+// Sine of angle, in 1/65536 turn, as 8.8 fixed point.
+int16_t Stick_Sin(const uint16_t angle)
+{
+	uint8_t step = angle >> 8;
+	int16_t s0 = SinStep(step);
+	int16_t s1 = SinStep(step + 1);
+	return s0 + (((s1 - s0) * (int16_t)(angle & 0xFF)) >> 8);
+}
+
+// Cosine, a quarter turn ahead.
+static inline int16_t Cos(const uint16_t angle)
+{
+	return Stick_Sin(angle + 0x4000);
+}
+
+// 8.8 fixed point product.
+static inline int32_t Mul(const int16_t a, const int16_t b)
+{
+	return ((int32_t)a * b) >> 8;
+}
+
+// Clamp a wide 8.8 value into an 8.8 field.
+static inline int16_t Fixed(const int32_t value)
+{
+	if (value < INT16_MIN)
+		return INT16_MIN;
+	if (value > INT16_MAX)
+		return INT16_MAX;
+	return value;
+}
+
+// Straight line from (x0, y0) to (x1, y1).
+void Stick_Line(Trajectory_t* const path, const int8_t x0, const int8_t y0, const int8_t x1, const int8_t y1, const uint16_t reports)
+{
+	path->Kind = PATH_LINE;
+	path->Reports = reports;
+	path->X = (int16_t)x0 * 256;
+	path->Y = (int16_t)y0 * 256;
+	// Whole units, interpolated from the start at every report so that no step is too big for 8.8.
+	path->DX = x1 - x0;
+	path->DY = y1 - y0;
+	path->Angle = 0;
+	path->AngleStep = reports > 1 ? reports - 1 : 1;
+}
+
+// Circle around (x, y), a full turn every turn_reports, counter-clockwise when turn_reports is positive.
+// With turn_reports 0 the stick stays at angle 0, and with 1 or -1 it turns a whole turn between reports, landing on the same point.
+void Stick_Circle(Trajectory_t* const path, const int8_t x, const int8_t y, const uint8_t radius, const int16_t turn_reports, const uint16_t reports)
+{
+	Stick_Spiral(path, x, y, radius, radius, turn_reports, reports);
+}
+
+// Spiral around (x, y), going from radius r0 to r1 over the whole path. turn_reports as for Stick_Circle.
+void Stick_Spiral(Trajectory_t* const path, const int8_t x, const int8_t y, const uint8_t r0, const uint8_t r1, const int16_t turn_reports, const uint16_t reports)
+{
+	path->Kind = PATH_CIRCLE;
+	path->Reports = reports;
+	path->X = (int16_t)x * 256;
+	path->Y = (int16_t)y * 256;
+	path->Angle = 0;
+	path->AngleStep = turn_reports != 0 ? (uint16_t)(65536L / turn_reports) : 0;
+	path->Radius = Fixed((int32_t)r0 * 256);
+	path->RadiusStep = reports > 1 ? Fixed((int32_t)(r1 - r0) * 256 / (reports - 1)) : 0;
+}
+
+// Ease in and out from (x0, y0) to (x1, y1).
+void Stick_Ramp(Trajectory_t* const path, const int8_t x0, const int8_t y0, const int8_t x1, const int8_t y1, const uint16_t reports)
+{
+	path->Kind = PATH_RAMP;
+	path->Reports = reports;
+	path->X = (int16_t)x0 * 256;
+	path->Y = (int16_t)y0 * 256;
+	// Whole units: the distance can be up to 255, past the 8.8 range.
+	path->DX = x1 - x0;
+	path->DY = y1 - y0;
+	path->Angle = 0;
+	path->AngleStep = reports > 1 ? 0xFFFF / (reports - 1) : 0;
+}
+
+// done / total of a whole distance, as 8.8, without overflowing 32 bits for any 16-bit done and total.
+static int32_t Part(const int16_t distance, const uint16_t done, const uint16_t total)
+{
+	int32_t product = (int32_t)distance * done;
+	return product / total * 256 + product % total * 256 / total;
+}
+
+// Turn an 8.8 position relative to the center into a report value.
+static inline uint8_t ToReport(const int32_t position)
+{
+	int32_t value = (position >> 8) + 128;
+	if (value < 0)
+		return 0;
+	if (value > 255)
+		return 255;
+	return value;
+}
+
+// Write the next stick position into *x and *y, as report values. Returns false, leaving them alone, once the path is over.
+bool Stick_Next(Trajectory_t* const path, uint8_t* const x, uint8_t* const y)
+{
+	if (path->Reports == 0)
+		return false;
+	path->Reports--;
+
+	switch (path->Kind)
+	{
+		case PATH_LINE:
+			// Angle counts the reports done out of AngleStep, reaching the end on the last one.
+			if (path->Reports == 0)
+				path->Angle = path->AngleStep;
+			*x = ToReport(path->X + Part(path->DX, path->Angle, path->AngleStep));
+			*y = ToReport(path->Y + Part(path->DY, path->Angle, path->AngleStep));
+			path->Angle++;
+			break;
+		case PATH_CIRCLE:
+			*x = ToReport(path->X + Mul(path->Radius, Cos(path->Angle)));
+			// Report Y grows downwards.
+			*y = ToReport(path->Y - Mul(path->Radius, Stick_Sin(path->Angle)));
+			path->Angle += path->AngleStep;
+			path->Radius = Fixed((int32_t)path->Radius + path->RadiusStep);
+			break;
+		case PATH_RAMP:
+		{
+			// Smoothstep, t * t * (3 - 2 * t), with t from 0.0 to 1.0 as 0 to 256.
+			int16_t t = ((uint32_t)path->Angle + 0x80) >> 8;
+			int16_t eased = ((int32_t)t * t * (768 - 2 * t)) >> 16;
+			*x = ToReport(path->X + (int32_t)path->DX * eased);
+			*y = ToReport(path->Y + (int32_t)path->DY * eased);
+			path->Angle += path->AngleStep;
+			break;
+		}
+	}
+	return true;
+}
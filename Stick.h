@@ -0,0 +1,45 @@
+/** \file
+ *
+ *  Header file for Stick.c.
+ */
+
+#ifndef _STICK_H_
+#define _STICK_H_
+
+// Includes
+#include <avr/pgmspace.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Type Defines
+// A stick path, advanced once per report. Positions are 8.8 fixed point, relative to the stick center,
+// so the stick range is -128.0 to 127.0. Angles are 1/65536 of a turn.
+typedef struct {
+	uint8_t  Kind;
+	uint16_t Reports;     // Reports left
+	int16_t  X, Y;        // Position (line), center (circle, spiral) or start (ramp)
+	int16_t  DX, DY;      // Distance to the end in whole units (line, ramp)
+	uint16_t Angle;       // Current angle (circle, spiral), reports done (line), or eased progress (ramp)
+	uint16_t AngleStep;   // Angle step per report (circle, spiral), reports to the end (line), or progress step (ramp)
+	int16_t  Radius;      // Current radius (circle, spiral)
+	int16_t  RadiusStep;  // Radius step per report (spiral)
+} Trajectory_t;
+
+// Function Prototypes
+// Sine of angle, in 1/65536 turn, as 8.8 fixed point.
+int16_t Stick_Sin(const uint16_t angle);
+
+// Straight line from (x0, y0) to (x1, y1).
+void Stick_Line(Trajectory_t* const path, const int8_t x0, const int8_t y0, const int8_t x1, const int8_t y1, const uint16_t reports);
+// Circle around (x, y), a full turn every turn_reports, counter-clockwise when turn_reports is positive.
+// With turn_reports 0 the stick stays at angle 0, and with 1 or -1 it turns a whole turn between reports, landing on the same point.
+void Stick_Circle(Trajectory_t* const path, const int8_t x, const int8_t y, const uint8_t radius, const int16_t turn_reports, const uint16_t reports);
+// Spiral around (x, y), going from radius r0 to r1 over the whole path. turn_reports as for Stick_Circle.
+void Stick_Spiral(Trajectory_t* const path, const int8_t x, const int8_t y, const uint8_t r0, const uint8_t r1, const int16_t turn_reports, const uint16_t reports);
+// Ease in and out from (x0, y0) to (x1, y1).
+void Stick_Ramp(Trajectory_t* const path, const int8_t x0, const int8_t y0, const int8_t x1, const int8_t y1, const uint16_t reports);
+
+// Write the next stick position into *x and *y, as report values. Returns false, leaving them alone, once the path is over.
+bool Stick_Next(Trajectory_t* const path, uint8_t* const x, uint8_t* const y);
+
+#endif
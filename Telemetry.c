@@ -0,0 +1,208 @@
+/** \file
+ *
+ *  Binary telemetry on a CDC-ACM interface next to the joystick, for benchmarking the printer
+ *  attached to a PC (see telemetry.py). Records are built in place in a ring and sent from
+ *  there straight to the endpoint bank, whole records at a time and only when the bank is
+ *  free: the joystick IN endpoint never waits on the telemetry.
+ */
+
+#include "Telemetry.h"
+
+#ifdef TELEMETRY
+
+#include "Profiler.h"
+#include "Ring.h"
+
+RING_DEFINE(TelemetryRing, TelemetryRecord_t, TELEMETRY_RECORDS)
+
+_Static_assert(sizeof(TelemetryRecord_t) <= CDC_TXRX_EPSIZE, "A record must fit in a packet");
+
+static TelemetryRing_t records;
+// Records dropped since the last TELEMETRY_REPORTS.
+static uint8_t dropped = 0;
+
+// Line coding, kept for the host to read back, and control line state set by the host.
+static CDC_LineEncoding_t line_encoding = {
+	.BaudRateBPS = 115200,
+	.CharFormat  = CDC_LINEENCODING_OneStopBit,
+	.ParityType  = CDC_PARITY_None,
+	.DataBits    = 8
+};
+static uint16_t line_state = 0;
+static bool paused = false;
+
+// Command waiting for its argument, 0 when none.
+static uint8_t command = 0;
+
+// Reports and longest IN interval since the last TELEMETRY_REPORTS, and when the next one is due.
+static uint16_t reports = 0;
+static uint16_t longest = 0;
+static uint32_t next_ms = 0;
+
+// Records are only kept while the host has the port open.
+static bool Streaming(void)
+{
+	return (line_state & CDC_CONTROL_LINE_OUT_DTR) && !paused;
+}
+
+// Configure the CDC endpoints, after the host set the configuration. Streaming waits for the host to open the port.
+bool Telemetry_ConfigureEndpoints(void)
+{
+	bool success = true;
+	success &= Endpoint_ConfigureEndpoint(CDC_NOTIFICATION_EPADDR, EP_TYPE_INTERRUPT, CDC_NOTIFICATION_EPSIZE, 1);
+	success &= Endpoint_ConfigureEndpoint(CDC_TX_EPADDR, EP_TYPE_BULK, CDC_TXRX_EPSIZE, 1);
+	success &= Endpoint_ConfigureEndpoint(CDC_RX_EPADDR, EP_TYPE_BULK, CDC_TXRX_EPSIZE, 1);
+	line_state = 0;
+	command = 0;
+	return success;
+}
+
+// Handle the CDC class requests to the control interface.
+void Telemetry_ControlRequest(void)
+{
+	if (USB_ControlRequest.wIndex != INTERFACE_ID_CDC_CCI)
+		return;
+
+	switch (USB_ControlRequest.bRequest)
+	{
+		case CDC_REQ_GetLineEncoding:
+			if (USB_ControlRequest.bmRequestType == (REQDIR_DEVICETOHOST | REQTYPE_CLASS | REQREC_INTERFACE))
+			{
+				Endpoint_ClearSETUP();
+				Endpoint_Write_Control_Stream_LE(&line_encoding, sizeof(CDC_LineEncoding_t));
+				Endpoint_ClearOUT();
+			}
+			break;
+		case CDC_REQ_SetLineEncoding:
+			// Any line coding goes, the data never leaves USB.
+			if (USB_ControlRequest.bmRequestType == (REQDIR_HOSTTODEVICE | REQTYPE_CLASS | REQREC_INTERFACE))
+			{
+				Endpoint_ClearSETUP();
+				Endpoint_Read_Control_Stream_LE(&line_encoding, sizeof(CDC_LineEncoding_t));
+				Endpoint_ClearIN();
+			}
+			break;
+		case CDC_REQ_SetControlLineState:
+			if (USB_ControlRequest.bmRequestType == (REQDIR_HOSTTODEVICE | REQTYPE_CLASS | REQREC_INTERFACE))
+			{
+				Endpoint_ClearSETUP();
+				Endpoint_ClearStatusStage();
+				line_state = USB_ControlRequest.wValue;
+				// Start afresh with every opening of the port.
+				paused = false;
+			}
+			break;
+	}
+}
+
+// Carry out a command, with its argument.
+static void Command(const uint8_t code, const uint8_t arg)
+{
+	switch (code)
+	{
+		case TELEMETRY_PAUSE:
+			paused = true;
+			break;
+		case TELEMETRY_GO:
+			paused = false;
+			break;
+		case TELEMETRY_RESET:
+			Profiler_Reset();
+			reports = 0;
+			longest = 0;
+			dropped = 0;
+			// Fall through
+		default:
+			CALLBACK_Telemetry_Command(code, arg);
+			break;
+	}
+}
+
+// Send the records waiting and take in the commands, without ever waiting for the host.
+void Telemetry_Task(void)
+{
+	if (USB_DeviceState != DEVICE_STATE_Configured)
+		return;
+
+	Endpoint_SelectEndpoint(CDC_RX_EPADDR);
+	if (Endpoint_IsOUTReceived())
+	{
+		while (Endpoint_BytesInEndpoint())
+		{
+			uint8_t byte = Endpoint_Read_8();
+			if (command == 0)
+			{
+				command = byte;
+			}
+			else
+			{
+				Command(command, byte);
+				command = 0;
+			}
+		}
+		Endpoint_ClearOUT();
+	}
+
+	// Records are dropped rather than queued while the port is closed, so none is stale once it opens.
+	if (!Streaming())
+	{
+		while (TelemetryRing_Peek(&records))
+			TelemetryRing_Release(&records);
+		return;
+	}
+
+	Endpoint_SelectEndpoint(CDC_TX_EPADDR);
+	if (!Endpoint_IsINReady() || !TelemetryRing_Count(&records))
+		return;
+	// As many whole records as the packet holds, copied from the ring to the bank.
+	TelemetryRecord_t* record;
+	while (Endpoint_BytesInEndpoint() + sizeof(TelemetryRecord_t) <= CDC_TXRX_EPSIZE && (record = TelemetryRing_Peek(&records)))
+	{
+		Endpoint_Write_Stream_LE(record, sizeof(TelemetryRecord_t), NULL);
+		TelemetryRing_Release(&records);
+	}
+	Endpoint_ClearIN();
+}
+
+// Queue a record, dropped when the port is closed, paused or full. Returns whether it was queued.
+bool Telemetry_Send(const uint8_t type, const uint8_t state, const uint8_t arg, const uint16_t a, const uint16_t b)
+{
+	if (!Streaming())
+		return false;
+	TelemetryRecord_t* record = TelemetryRing_Reserve(&records);
+	if (!record)
+	{
+		if (dropped < 0xFF)
+			dropped++;
+		return false;
+	}
+	record->Sync = TELEMETRY_SYNC;
+	record->Type = type;
+	record->State = state;
+	record->Arg = arg;
+	record->Micros = Timer_Micros();
+	record->A = a;
+	record->B = b;
+	TelemetryRing_Commit(&records);
+	return true;
+}
+
+// Count a report and the IN interval before it, in timer ticks. Sends TELEMETRY_REPORTS and returns true once per second.
+bool Telemetry_Report(const uint8_t state, const uint16_t interval)
+{
+	reports++;
+	if (interval > longest)
+		longest = interval;
+	uint32_t now = Timer_Millis();
+	if (!Timer_Reached(now, next_ms))
+		return false;
+	next_ms = now + 1000;
+	// Drops are counted until a record carries their count.
+	if (Telemetry_Send(TELEMETRY_REPORTS, state, dropped, reports, longest / TIMER_TICKS_PER_US))
+		dropped = 0;
+	reports = 0;
+	longest = 0;
+	return true;
+}
+
+#endif
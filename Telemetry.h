@@ -0,0 +1,64 @@
+/** \file
+ *
+ *  Header file for Telemetry.c.
+ */
+
+#ifndef _TELEMETRY_H_
+#define _TELEMETRY_H_
+
+// Includes
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <LUFA/Drivers/USB/USB.h>
+
+#include "AppConfig.h"
+#include "Descriptors.h"
+#include "Timer.h"
+
+// Macros
+// Records waiting for the host, the newest ones are dropped when it doesn't keep up.
+#define TELEMETRY_RECORDS 16
+// First byte of every record, to find where records start in the stream.
+#define TELEMETRY_SYNC 0xA5
+
+// Record types.
+#define TELEMETRY_STATE    0x01 // The printer entered State. Arg: previous state, A, B: cursor position
+#define TELEMETRY_REPORTS  0x02 // Every second. Arg: records dropped since the last one, A: reports prepared, B: longest IN interval in us
+#define TELEMETRY_FEEDBACK 0x03 // Every second with OUT_FEEDBACK. A: reports acknowledged, B: reports whose hold ran out
+#define TELEMETRY_REPLY    0x04 // Answer to a command. Arg: the command, A, B: depend on it
+
+// Commands, two bytes each: the command, then its argument or 0.
+#define TELEMETRY_PAUSE    'p'  // Stop streaming
+#define TELEMETRY_GO       'g'  // Stream again
+#define TELEMETRY_RESET    'r'  // Clear the statistics
+#define TELEMETRY_STATUS   's'  // Reply with the cursor position
+#define TELEMETRY_ECHOES   'e'  // Set the number of echoes of every report, until the next boot. Reply with the number in effect
+
+// Type Defines
+// Telemetry record, little endian with no padding.
+typedef struct {
+	uint8_t  Sync;   // TELEMETRY_SYNC
+	uint8_t  Type;   // One of the record types
+	uint8_t  State;  // Printer state
+	uint8_t  Arg;
+	uint32_t Micros; // Timer_Micros at the event
+	uint16_t A;
+	uint16_t B;
+} TelemetryRecord_t;
+
+// Function Prototypes
+// Configure the CDC endpoints, after the host set the configuration. Streaming waits for the host to open the port.
+bool Telemetry_ConfigureEndpoints(void);
+// Handle the CDC class requests to the control interface.
+void Telemetry_ControlRequest(void);
+// Send the records waiting and take in the commands, without ever waiting for the host.
+void Telemetry_Task(void);
+// Queue a record, dropped when the port is closed, paused or full. Returns whether it was queued.
+bool Telemetry_Send(const uint8_t type, const uint8_t state, const uint8_t arg, const uint16_t a, const uint16_t b);
+// Count a report and the IN interval before it, in timer ticks. Sends TELEMETRY_REPORTS and returns true once per second.
+bool Telemetry_Report(const uint8_t state, const uint16_t interval);
+// Commands other than pause and go, carried out by the application.
+void CALLBACK_Telemetry_Command(const uint8_t command, const uint8_t arg);
+
+#endif
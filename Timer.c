@@ -0,0 +1,77 @@
+/** \file
+ *
+ *  Free running hardware timer, used to measure the host poll rate, and extended by its overflow
+ *  interrupt into the monotonic microsecond and millisecond clocks every delay is scheduled on.
+ */
+
+#include "Timer.h"
+
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+// Turns of the 16-bit counter, and the milliseconds and leftover microseconds they add up to.
+static volatile uint32_t overflows = 0;
+static volatile uint32_t overflow_ms = 0;
+static volatile uint16_t overflow_us = 0;
+
+// Start the free running timer.
+void Timer_Init(void)
+{
+	// Normal mode, no output compare, interrupt on overflow only.
+	TCCR1A = 0;
+	TCCR1B = (1 << CS11);
+	TCNT1 = 0;
+	TIMSK1 = (1 << TOIE1);
+}
+
+// Counter overflow, every TIMER_OVERFLOW_US.
+ISR(TIMER1_OVF_vect)
+{
+	overflows++;
+	overflow_ms += TIMER_OVERFLOW_US / 1000;
+	overflow_us += TIMER_OVERFLOW_US % 1000;
+	if (overflow_us >= 1000)
+	{
+		overflow_us -= 1000;
+		overflow_ms++;
+	}
+}
+
+// Read the counter along with the overflows before it, as if at once.
+static uint16_t Read(uint32_t* const turns, uint32_t* const ms, uint16_t* const us)
+{
+	uint16_t ticks;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		ticks = TCNT1;
+		*turns = overflows;
+		*ms = overflow_ms;
+		*us = overflow_us;
+		// An overflow not serviced yet, the counter having wrapped right before it was read.
+		if ((TIFR1 & (1 << TOV1)) && ticks < 0x8000)
+		{
+			(*turns)++;
+			*ms += TIMER_OVERFLOW_US / 1000;
+			*us += TIMER_OVERFLOW_US % 1000;
+		}
+	}
+	return ticks;
+}
+
+// Microseconds since Timer_Init, wrapping after about 71 minutes.
+uint32_t Timer_Micros(void)
+{
+	uint32_t turns, ms;
+	uint16_t us;
+	uint16_t ticks = Read(&turns, &ms, &us);
+	return turns * TIMER_OVERFLOW_US + ticks / TIMER_TICKS_PER_US;
+}
+
+// Milliseconds since Timer_Init, wrapping after about 49 days.
+uint32_t Timer_Millis(void)
+{
+	uint32_t turns, ms;
+	uint16_t us;
+	uint16_t ticks = Read(&turns, &ms, &us);
+	return ms + (us + ticks / TIMER_TICKS_PER_US) / 1000;
+}
@@ -0,0 +1,43 @@
+/** \file
+ *
+ *  Header file for Timer.c.
+ */
+
+#ifndef _TIMER_H_
+#define _TIMER_H_
+
+// Includes
+#include <avr/io.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Macros
+// Timer1 runs free at F_CPU / 8, that is 0.5 us per tick at 16 MHz.
+// The 16-bit counter wraps every 32.768 ms at 16 MHz, so only measure intervals shorter than that with Timer_Ticks.
+#define TIMER_TICKS_PER_MS (F_CPU / 8 / 1000)
+#define TIMER_TICKS_PER_US (F_CPU / 8 / 1000000)
+// Microseconds per turn of the 16-bit counter.
+#define TIMER_OVERFLOW_US (65536UL / TIMER_TICKS_PER_US)
+
+// Function Prototypes
+// Start the free running timer.
+void Timer_Init(void);
+// Microseconds since Timer_Init, wrapping after about 71 minutes.
+uint32_t Timer_Micros(void);
+// Milliseconds since Timer_Init, wrapping after about 49 days.
+uint32_t Timer_Millis(void);
+
+// Current timer count, subtract two readings to get an interval in ticks.
+static inline uint16_t Timer_Ticks(void)
+{
+	return TCNT1;
+}
+
+// Whether a deadline on the Timer_Micros or Timer_Millis clock passed, correct across their wrap
+// for deadlines less than half of it away.
+static inline bool Timer_Reached(const uint32_t now, const uint32_t deadline)
+{
+	return (int32_t)(now - deadline) >= 0;
+}
+
+#endif
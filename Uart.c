@@ -0,0 +1,68 @@
+/** \file
+ *
+ *  Image rows streamed by the host over USART1 (RXD1 on PD2, TXD1 on PD3), into a ring filled
+ *  by the receive interrupt. The host must only send what it holds credits for (see Uart.h), so
+ *  the ring never overflows whatever the latency of its serial adapter.
+ */
+
+#include "Uart.h"
+
+#ifdef IMAGE_UART
+
+#include "Ring.h"
+
+RING_DEFINE(UartRing, uint8_t, UART_RING_SIZE)
+
+_Static_assert(UART_RING_SIZE % UART_CREDIT_BYTES == 0, "The ring must hold a whole number of credits");
+
+// Received bytes, and bytes read since the last credit sent.
+static UartRing_t received;
+static uint8_t consumed = 0;
+
+// Send a byte, the transmitter only sends a byte every few credits so it is never busy for long.
+static void Send(const uint8_t byte)
+{
+	while (!(UCSR1A & (1 << UDRE1)));
+	UDR1 = byte;
+}
+
+// Start receiving, and ask the host for an image.
+void Uart_Init(void)
+{
+	// Double speed, 8N1, receive interrupt.
+	UBRR1 = (F_CPU + 4UL * UART_BAUD) / (8UL * UART_BAUD) - 1;
+	UCSR1A = (1 << U2X1);
+	UCSR1C = (1 << UCSZ11) | (1 << UCSZ10);
+	UCSR1B = (1 << RXCIE1) | (1 << RXEN1) | (1 << TXEN1);
+
+	Send(UART_ENQ);
+}
+
+// Queue every received byte.
+ISR(USART1_RX_vect)
+{
+	uint8_t byte = UDR1;
+	// Can only fail when the host ignores the credits, the byte is then lost.
+	UartRing_Push(&received, &byte);
+}
+
+// Bytes received and not read yet.
+uint8_t Uart_Available(void)
+{
+	return UartRing_Count(&received);
+}
+
+// Next received byte, waits for it if none is available.
+uint8_t Uart_Read(void)
+{
+	uint8_t byte;
+	while (!UartRing_Pop(&received, &byte));
+	if (++consumed == UART_CREDIT_BYTES)
+	{
+		consumed = 0;
+		Send(UART_ACK);
+	}
+	return byte;
+}
+
+#endif
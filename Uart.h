@@ -0,0 +1,38 @@
+/** \file
+ *
+ *  Header file for Uart.c.
+ */
+
+#ifndef _UART_H_
+#define _UART_H_
+
+// Includes
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "AppConfig.h"
+
+// Macros
+#ifndef UART_BAUD
+	#define UART_BAUD 115200
+#endif
+
+// Flow control is credit based: the host never has more than UART_CREDIT_BYTES bytes in flight per
+// credit it holds. The printer sends UART_ENQ when it wants an image, which grants a full receive ring
+// of credits, then UART_ACK for every UART_CREDIT_BYTES bytes it takes out of the ring.
+#define UART_ENQ 0x05
+#define UART_ACK 0x06
+#define UART_CREDIT_BYTES 16
+#define UART_RING_SIZE 128
+
+// Function Prototypes
+// Start receiving, and ask the host for an image.
+void Uart_Init(void);
+// Bytes received and not read yet.
+uint8_t Uart_Available(void);
+// Next received byte, waits for it if none is available.
+uint8_t Uart_Read(void);
+
+#endif
@@ -4,3 +4,5 @@
 #include <avr/pgmspace.h>
 
 const uint8_t image_data[0x12c1] PROGMEM = {0x57, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xea, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0xf1, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0x40, 0xf2, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0x80, 0xf1, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0x40, 0xf2, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0x80, 0xe1, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0x40, 0xc2, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0x80, 0x81, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x40, 0x2, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x80, 0x1, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0x4f, 0x12, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x8f, 0x31, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x4f, 0x72, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x8f, 0xf1, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0x4e, 0xf2, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0x8c, 0xf1, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0x48, 0xf2, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0x80, 0xf1, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0x40, 0xf2, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0x88, 0xf1, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0x4c, 0xf2, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0x8e, 0x71, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x4f, 0x32, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x8f, 0x11, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x4f, 0x2, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0x8f, 0x1, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x47, 0x2, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x83, 0x1, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x43, 0x2, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x87, 0x1, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0x4f, 0x12, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x8f, 0x71, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x4f, 0xf2, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0x8f, 0xf1, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0x4e, 0x72, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x8c, 0x1, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x40, 0x2, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x80, 0x1, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x40, 0x2, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x81, 0x1, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x43, 0x2, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x83, 0x1, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x43, 0x2, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x83, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x41, 0x2, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x80, 0x1, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x40, 0x2, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x80, 0x1, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x40, 0x2, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x80, 0xf1, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0x48, 0xf2, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0x8c, 0xf1, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0x4c, 0xf2, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0x88, 0xe1, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0x40, 0xc2, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0x80, 0x81, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x40, 0x2, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x80, 0x1, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x40, 0x82, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0xc1, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0x40, 0xe2, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0x80, 0xf1, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0x40, 0xf2, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0x88, 0xf1, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0x4c, 0xf2, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0x8e, 0x71, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x4f, 0x32, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x8f, 0x31, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x4f, 0x72, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x8f, 0xf1, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0x4e, 0xf2, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0x8c, 0xf1, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0x48, 0xf2, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0x80, 0xe1, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0x40, 0xc2, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0x81, 0x1, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x43, 0x2, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x87, 0x1, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0x4f, 0x12, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x8f, 0x31, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x4f, 0x32, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x8f, 0x31, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x4f, 0x32, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x8f, 0x11, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x4f, 0x2, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0x8f, 0x1, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x47, 0x2, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x83, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x41, 0x2, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x80, 0x81, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x40, 0xc2, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0x80, 0xc1, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0x40, 0x82, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x1, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x40, 0x2, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x81, 0x1, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x47, 0x2, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0x8f, 0x1, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0x4f, 0x2, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x87, 0x1, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x40, 0x2, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x80, 0x1, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x40, 0x82, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0xc1, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0x40, 0xe2, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0x80, 0xf1, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf0, 0x7, 0xf8, 0xe0, 0xf, 0xf0, 0x3, 0x7f, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0x40, 0xf2, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0xf0, 0x3, 0xfc, 0xc1, 0x7, 0xf8, 0x3, 0x3f, 0xc0, 0x1f, 0x7c, 0x80, 0x3f, 0x80, 0xf1, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0xf0, 0x3, 0xfc, 0x3, 0x0, 0xfc, 0x1, 0x3f, 0xc0, 0x3f, 0x0, 0xc0, 0x1f, 0x40, 0xf2, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0xf0, 0x7, 0xf8, 0x7, 0x0, 0xfe, 0x0, 0x7f, 0x80, 0x7f, 0x0, 0xe0, 0xf, 0x80, 0xe1, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0xe0, 0xf, 0xe0, 0xf, 0x0, 0x7f, 0x0, 0xfe, 0x0, 0xfe, 0x0, 0xf0, 0x7, 0x40, 0xc2, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xf8, 0x3, 0x80, 0x81, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0x1f, 0x0, 0xf8, 0x7, 0xf8, 0x3, 0xfc, 0x1, 0x40, 0x2, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x3, 0xfe, 0x0, 0x80, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x57, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xea, 0x0};
+const uint8_t image_flags[1] PROGMEM = {0x0};
+const uint8_t* const image_plan[1] PROGMEM = {0};
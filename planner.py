@@ -0,0 +1,463 @@
+#!/bin/python
+
+import sys, os, re, getopt
+import numpy as np
+
+# Must match Joystick.c and the makefile.
+POLLING_MS = 8
+ECHOES = 3
+SYNC_MS = 2000 + 4000
+FILL_BRUSH_PRESSES = 2
+# Estimates, not measured yet: side of the largest brush in pixels, time for a sweep holding the stick
+# to cross the canvas, and time to get home from the bottom right corner. Override them with
+# --fill-brush-px, --fill-sweep-ms and --fill-home-ms once measured on the console.
+FILL_BRUSH_PX = 6
+FILL_SWEEP_MS = 2000
+FILL_HOME_MS = 4000
+WIDTH = 320
+HEIGHT = 120
+
+def row_extents(bits):
+  # Leftmost and rightmost inked pixel of every row, WIDTH and -1 for blank rows, as Bitmap_First/Last.
+  inked = bits.any(axis=1)
+  first = np.where(inked, bits.argmax(axis=1), WIDTH)
+  last = np.where(inked, WIDTH - 1 - bits[:, ::-1].argmax(axis=1), -1)
+  return first.tolist(), last.tolist()
+
+def print_steps(bits, skip_blanks=False):
+  # State reports sent by the serpentine traversal of Joystick.c, from the first STOP_X to DONE.
+  # Every move is a MOVE_X followed by a STOP_X (STOP_Y at the edges), every row starts with a
+  # STOP_X and ends with a MOVE_Y. With skip_blanks, for SKIP_BLANKS builds, a row ends as soon as
+  # the rest of it and the part of the next row the way back won't cover are blank.
+  first, last = row_extents(bits)
+  first.append(WIDTH)
+  last.append(-1)
+  steps = 0
+  x = 0
+  for y in range(0, HEIGHT):
+    if y % 2 == 0:
+      end = min(max(last[y], last[y + 1]), WIDTH - 1) if skip_blanks else WIDTH - 1
+      moves = max(0, end - x)
+      x += moves
+    else:
+      end = max(min(first[y], first[y + 1]), 0) if skip_blanks else 0
+      moves = max(0, x - end)
+      x -= moves
+    steps += 1 + 2 * moves + (1 if y < HEIGHT - 1 else 0)
+  return steps
+
+def print_time(bits, skip_blanks=False):
+  # Seconds from plugging in to DONE, when every state report is echoed ECHOES times.
+  return (SYNC_MS + print_steps(bits, skip_blanks) * (ECHOES + 1) * POLLING_MS) / 1000
+
+# Plan opcodes and sweep directions, must match Plan.h.
+PLAN_END = 0x00
+PLAN_MOVE = 0x01
+PLAN_LINE = 0x02
+PLAN_DOT = 0x03
+PLAN_BRUSH = 0x04
+PLAN_PEN = 0x05
+PLAN_SWEEP = 0x06
+PLAN_STROKE = 0x07
+PLAN_TEXT = 0x08
+SWEEPS = {"right": 0, "left": 1, "down": 2, "home": 3}
+PLAN_SWEEP_PEN = 0x80
+
+# Image flags, must match Bitmap.h.
+IMAGE_ERASE = 0x01
+IMAGE_NO_RASTER = 0x02
+IMAGE_KEEP = 0x04
+
+# Plans bigger than this are not worth their flash.
+PLAN_MAX_BYTES = 2048
+
+# A plan is a list of commands, carried out by the PLAN state of Joystick.c before the row by row pass:
+#   ("move", dx, dy)          pen up, along X then Y
+#   ("line", dx, dy)          holding the pen
+#   ("stroke", dx, dy)        holding the pen, diagonals included
+#   ("text", scale, text)     written from here, expanded on the printer (see text_commands)
+#   ("dot",)                  press the pen here
+#   ("brush", n)              n sizes bigger, or -n smaller
+#   ("pen", erase)            ink with A, or erase with B
+#   ("sweep", way, pen, ms)   stick held right, left, down or home (up and left) for ms
+
+def report_ms():
+  return (ECHOES + 1) * POLLING_MS
+
+def sweep_units(ms):
+  return min(255, (ms + 15) // 16)
+
+# Font of Font.h and Font.c.
+FONT_WIDTH = 5
+FONT_HEIGHT = 7
+FONT_ADVANCE = 6
+FONT_LINE = 8
+FONT_FIRST = ' '
+FONT_LAST = '~'
+
+def font_glyphs():
+  # Columns of every glyph, read from Font.c.
+  with open(os.path.join(os.path.dirname(os.path.abspath(__file__)), "Font.c")) as f:
+    rows = re.findall(r"^\t((?:0x[0-9A-Fa-f]{2}, ){%d})//" % FONT_WIDTH, f.read(), re.M)
+  return [[int(v, 16) for v in row.split(",")[:FONT_WIDTH]] for row in rows]
+
+def text_commands(scale, text):
+  # Moves, dots and lines the printer writes a PLAN_TEXT command with, from where it starts, as Plan.c:
+  # every vertical run of pixels of a glyph column is a block scale pixels wide, drawn as vertical lines
+  # going down and up in turn, one block after the other.
+  glyphs = font_glyphs()
+  commands = []
+  pen_x = pen_y = 0
+  cursor_x = cursor_y = 0
+  for character in text:
+    if character == "\n":
+      cursor_x = 0
+      cursor_y += FONT_LINE * scale
+      continue
+    if not FONT_FIRST <= character <= FONT_LAST:
+      character = "?"
+    for column, bits in enumerate(glyphs[ord(character) - ord(FONT_FIRST)]):
+      row = 0
+      while row < FONT_HEIGHT:
+        if not bits >> row & 1:
+          row += 1
+          continue
+        block_x = cursor_x + column * scale
+        block_y = cursor_y + row * scale
+        height = 0
+        while row < FONT_HEIGHT and bits >> row & 1:
+          height += scale
+          row += 1
+        if (block_x, block_y) != (pen_x, pen_y):
+          commands.append(("move", block_x - pen_x, block_y - pen_y))
+        commands.append(("dot",))
+        pen_x, pen_y = block_x, block_y
+        for line in range(0, scale):
+          if line > 0:
+            commands.append(("line", 1, 0))
+            pen_x += 1
+          if height > 1:
+            commands.append(("line", 0, height - 1 if line % 2 == 0 else 1 - height))
+            pen_y += height - 1 if line % 2 == 0 else 1 - height
+    cursor_x += FONT_ADVANCE * scale
+  return commands
+
+def expand(plan):
+  # Plan with its text commands replaced by what the printer writes them with.
+  out = []
+  for command in plan:
+    out += text_commands(command[1], command[2]) if command[0] == "text" else [command]
+  return out
+
+def text_size(text, scale):
+  # Width and height of a text on the canvas.
+  lines = text.split("\n")
+  return (FONT_ADVANCE * max(len(line) for line in lines) - 1) * scale, (FONT_LINE * len(lines) - 1) * scale
+
+def text_plan(text, scale=None, x=None, y=None):
+  # Plan writing a text, as large as it fits if scale is None, centered unless x and y are given.
+  lines = text.split("\n")
+  if scale is None:
+    width, height = text_size(text, 1)
+    scale = max(1, min(WIDTH // (width + 1), HEIGHT // (height + 1)))
+  width, height = text_size(text, scale)
+  if width > WIDTH or height > HEIGHT:
+    print("WARNING: The text is {}x{} pixels, larger than the canvas!".format(width, height))
+  x = (WIDTH - width) // 2 if x is None else x
+  y = (HEIGHT - height) // 2 if y is None else y
+  plan = [("move", max(x, 0), max(y, 0))]
+  # At most 255 characters per command, from the start of a line.
+  chunk = []
+  for n, line in enumerate(lines):
+    if chunk and len("\n".join(chunk + [line])) > 255:
+      plan.append(("text", scale, "\n".join(chunk)))
+      plan.append(("move", max(x, 0) - plan_end(plan)[0], max(y, 0) + FONT_LINE * scale * n - plan_end(plan)[1]))
+      chunk = []
+    chunk.append(line[:255])
+  return plan + [("text", scale, "\n".join(chunk))]
+
+def plan_steps(plan):
+  # State reports the PLAN state sends for a plan.
+  steps = 0
+  for command in expand(plan):
+    if command[0] in ("move", "line"):
+      steps += 2 * (abs(command[1]) + abs(command[2]))
+    elif command[0] == "stroke":
+      steps += 2 * max(abs(command[1]), abs(command[2]))
+    elif command[0] == "dot":
+      steps += 1
+    elif command[0] == "brush":
+      steps += 2 * abs(command[1])
+    elif command[0] == "sweep":
+      # Reports go on until the sweep time is up.
+      steps += max(-(-sweep_units(command[3]) * 16 // report_ms()), 1)
+  return steps
+
+def split(dx, dy):
+  # Pieces of at most 127 pixels along each axis, in the same direction.
+  pieces = max(1, (max(abs(dx), abs(dy)) + 126) // 127)
+  done_x = done_y = 0
+  for i in range(1, pieces + 1):
+    x = dx * i // pieces if dx >= 0 else -(-dx * i // pieces)
+    y = dy * i // pieces if dy >= 0 else -(-dy * i // pieces)
+    yield x - done_x, y - done_y
+    done_x, done_y = x, y
+
+def encode_plan(plan):
+  # Plan.h byte stream, ending with PLAN_END.
+  out = []
+  for command in plan:
+    if command[0] == "text":
+      out += [PLAN_TEXT, command[1], len(command[2])] + [ord(c) if ord(c) < 0x80 else ord("?") for c in command[2]]
+    elif command[0] in ("move", "line", "stroke"):
+      op = {"move": PLAN_MOVE, "line": PLAN_LINE, "stroke": PLAN_STROKE}[command[0]]
+      for dx, dy in split(command[1], command[2]):
+        out += [op, dx & 0xFF, dy & 0xFF]
+    elif command[0] == "dot":
+      out += [PLAN_DOT]
+    elif command[0] == "brush":
+      out += [PLAN_BRUSH, command[1] & 0xFF]
+    elif command[0] == "pen":
+      out += [PLAN_PEN, 1 if command[1] else 0]
+    elif command[0] == "sweep":
+      out += [PLAN_SWEEP, SWEEPS[command[1]] | (PLAN_SWEEP_PEN if command[2] else 0), sweep_units(command[3])]
+  return out + [PLAN_END]
+
+def fill_plan():
+  # Largest brush, serpentine sweeps holding A one brush apart, back to the top left corner, smallest brush.
+  plan = [("brush", FILL_BRUSH_PRESSES)]
+  for row in range(0, HEIGHT // FILL_BRUSH_PX + 1):
+    plan += [("sweep", "left" if row % 2 else "right", True, FILL_SWEEP_MS), ("line", 0, FILL_BRUSH_PX)]
+  return plan + [("sweep", "home", False, FILL_HOME_MS), ("brush", -FILL_BRUSH_PRESSES)]
+
+def stroke_steps(dx, dy):
+  # Offsets the pen goes through along a stroke, as the PLAN state steps it: after step k of n,
+  # k / n of the way along both axes, rounded.
+  n = max(abs(dx), abs(dy))
+  return [(int(np.sign(dx)) * ((2 * k * abs(dx) + n) // (2 * n)), int(np.sign(dy)) * ((2 * k * abs(dy) + n) // (2 * n)))
+          for k in range(1, n + 1)]
+
+def plan_pixels(plan):
+  # Pixels set by a plan of pixel pen moves, lines, strokes and dots, from the top left corner of a
+  # blank canvas. Brush sizes and sweeps are not modelled.
+  bits = np.zeros((HEIGHT, WIDTH), np.uint8)
+  x = y = 0
+  ink = 1
+  for command in expand(plan):
+    if command[0] == "pen":
+      ink = 0 if command[1] else 1
+    elif command[0] == "dot":
+      bits[y, x] = ink
+    elif command[0] in ("move", "line"):
+      # Moves go along X first, lines step along X or Y whichever keeps closest to the line.
+      ax, ay = abs(command[1]), abs(command[2])
+      done_x = done_y = 0
+      while done_x < ax or done_y < ay:
+        if done_x < ax and (command[0] == "move" or done_y >= ay or (2 * done_x + 1) * ay <= (2 * done_y + 1) * ax):
+          done_x += 1
+          x += int(np.sign(command[1]))
+        else:
+          done_y += 1
+          y += int(np.sign(command[2]))
+        if command[0] == "line":
+          bits[y, x] = ink
+    elif command[0] == "stroke":
+      for pieces in split(command[1], command[2]):
+        for sx, sy in stroke_steps(*pieces):
+          bits[y + sy, x + sx] = ink
+        x += pieces[0]
+        y += pieces[1]
+  return bits
+
+def runs(bits):
+  # Horizontal runs of set pixels, as (y, first x, last x).
+  out = []
+  for y in range(0, HEIGHT):
+    edges = np.flatnonzero(np.diff(bits[y], prepend=0, append=0))
+    out += [(y, int(a), int(b) - 1) for a, b in zip(edges[0::2], edges[1::2])]
+  return out
+
+def route(segments, x, y):
+  # Order horizontal segments by nearest neighbour from x, y, each gone through from its nearest end.
+  # Returns (start x, end x, y) in order, and where it ends.
+  left = np.array([s[1] for s in segments])
+  right = np.array([s[2] for s in segments])
+  rows = np.array([s[0] for s in segments])
+  todo = np.ones(len(segments), bool)
+  order = []
+  for _ in range(0, len(segments)):
+    to_left = np.abs(left - x) + np.abs(rows - y)
+    to_right = np.abs(right - x) + np.abs(rows - y)
+    near = np.where(todo, np.minimum(to_left, to_right), 1 << 30)
+    i = int(near.argmin())
+    todo[i] = False
+    if to_left[i] <= to_right[i]:
+      order.append((int(left[i]), int(right[i]), int(rows[i])))
+    else:
+      order.append((int(right[i]), int(left[i]), int(rows[i])))
+    x, y = order[-1][1], order[-1][2]
+  return order, x, y
+
+def trace_route(order, x, y):
+  # Plan going through the routed segments holding the pen, pressed first at every start.
+  plan = []
+  for start, end, row in order:
+    if (start, row) != (x, y):
+      plan.append(("move", start - x, row - y))
+    plan.append(("dot",))
+    if end != start:
+      plan.append(("line", end - start, 0))
+    x, y = end, row
+  return plan, x, y
+
+def brush_strokes(bits):
+  # Strokes of the largest brush over the solid areas, top to bottom, wherever a stroke still covers
+  # mostly uncovered pixels. The brush covers FILL_BRUSH_PX square, its top left corner half of it
+  # up and left of the cursor. Returns the strokes as segments of cursor positions, and what they cover.
+  size = FILL_BRUSH_PX
+  offset = size // 2
+  total = np.pad(bits.astype(np.int32), ((1, 0), (1, 0))).cumsum(0).cumsum(1)
+  # Whether the brush fits in the image, for every top left corner of it.
+  full = (total[size:, size:] - total[:-size, size:] - total[size:, :-size] + total[:-size, :-size]) == size * size
+  covered = np.zeros(bits.shape, bool)
+  strokes = []
+  for top in range(0, full.shape[0]):
+    edges = np.flatnonzero(np.diff(full[top].astype(np.int8), prepend=0, append=0))
+    for a, b in zip(edges[0::2], edges[1::2]):
+      area = covered[top:top + size, a:b - 1 + size]
+      if np.count_nonzero(~area) * 2 > area.size:
+        covered[top:top + size, a:b - 1 + size] = True
+        strokes.append((top + offset, int(a) + offset, int(b) - 1 + offset))
+  return strokes, covered
+
+def brush_plan(bits, x, y):
+  # Plan going through the brush strokes over the pixels set from x, y, back to the smallest brush.
+  # Returns it, where it ends, and what it covers.
+  strokes, covered = brush_strokes(bits)
+  if not strokes:
+    return [], x, y, covered
+  order, _, _ = route(strokes, x, y)
+  plan, x, y = trace_route(order, x, y)
+  return [("brush", FILL_BRUSH_PRESSES)] + plan + [("brush", -FILL_BRUSH_PRESSES)], x, y, covered
+
+def strokes_plan(bits, x, y, brushes=False):
+  # Plan going through the pixels set from x, y: brush strokes over the solid areas first with brushes,
+  # then pen strokes over the rest. Returns it, and where it ends.
+  plan = []
+  if brushes:
+    plan, x, y, covered = brush_plan(bits, x, y)
+    bits = bits & ~covered
+  rest_runs = runs(bits)
+  if rest_runs:
+    order, _, _ = route(rest_runs, x, y)
+    pen, x, y = trace_route(order, x, y)
+    plan += pen
+  return plan, x, y
+
+def candidates(bits, erase=False, brushes=False, previous=None):
+  # Ways to print the pixels set, as (name, flags, raster bits, plan).
+  # With the pixels set of the previous image, also the way that only changes what differs from it.
+  none = np.zeros(bits.shape, np.uint8)
+  yield "rows", 0, bits, []
+  if erase:
+    yield "fill and erase rows", IMAGE_ERASE, bits ^ 1, fill_plan()
+  if brushes:
+    if len(runs(bits)) > 0:
+      yield "pen strokes", IMAGE_NO_RASTER, none, strokes_plan(bits, 0, 0)[0]
+    plan, x, y, covered = brush_plan(bits, 0, 0)
+    if plan:
+      yield "brush strokes and rows", 0, bits & ~covered, plan + [("move", -x, -y)]
+      yield "brush and pen strokes", IMAGE_NO_RASTER, none, strokes_plan(bits, 0, 0, True)[0]
+  if previous is not None:
+    # Ink what turned black, then erase what turned white, on the canvas as it was left.
+    plan, x, y = strokes_plan(bits & ~previous, 0, 0, brushes)
+    erased, x, y = strokes_plan(previous & ~bits, x, y, brushes)
+    if erased:
+      plan += [("pen", True)] + erased
+    yield "changes only", IMAGE_KEEP | IMAGE_NO_RASTER, none, plan
+
+def plan_end(plan):
+  # Where the cursor is after a plan without sweeps, starting from the top left corner.
+  x = y = 0
+  for command in expand(plan):
+    if command[0] in ("move", "line", "stroke"):
+      x += command[1]
+      y += command[2]
+  return x, y
+
+def total_time(flags, raster, plan, skip_blanks=False):
+  # Seconds from plugging in to DONE.
+  steps = plan_steps(plan) + (0 if flags & IMAGE_NO_RASTER else print_steps(raster, skip_blanks))
+  return (SYNC_MS + steps * report_ms()) / 1000
+
+def choose_print(bits, erase=False, brushes=False, previous=None, skip_blanks=False):
+  # Fastest way to print the pixels set whose plan fits in PLAN_MAX_BYTES.
+  # Returns (name, flags, raster bits, encoded plan or None, seconds).
+  best = None
+  for name, flags, raster, plan in candidates(bits, erase, brushes, previous):
+    encoded = encode_plan(plan) if plan else None
+    if encoded and len(encoded) > PLAN_MAX_BYTES:
+      continue
+    seconds = total_time(flags, raster, plan, skip_blanks)
+    if best is None or seconds < best[4]:
+      best = (name, flags, raster, encoded, seconds)
+  return best
+
+def set_fill(opt, arg):
+  # Fill estimates given on the command line, see FILL_BRUSH_PX. Returns whether opt is one of them.
+  global FILL_BRUSH_PX, FILL_SWEEP_MS, FILL_HOME_MS
+  if opt == '--fill-brush-px':
+    FILL_BRUSH_PX = int(arg)
+  elif opt == '--fill-sweep-ms':
+    FILL_SWEEP_MS = int(arg)
+  elif opt == '--fill-home-ms':
+    FILL_HOME_MS = int(arg)
+  else:
+    return False
+  return True
+
+FILL_OPTIONS = ["fill-brush-px=", "fill-sweep-ms=", "fill-home-ms="]
+
+def main(argv):
+  opts, args = getopt.getopt(argv, "hiu:", ["skip-blanks"] + FILL_OPTIONS)
+  invertColormap = False
+  previous = None
+  skip_blanks = False
+
+  for opt, arg in opts:
+    if opt == '-h':
+      usage()
+      sys.exit()
+    elif opt == '-i':
+      invertColormap = True
+    elif opt == '-u':
+      previous = arg
+    elif opt == '--skip-blanks':
+      skip_blanks = True
+    else:
+      set_fill(opt, arg)
+
+  from png2c import load, image_bits
+  if previous is not None:
+    previous = image_bits(load(previous), invertColormap)
+  for path in args:
+    bits = image_bits(load(path), invertColormap)
+    print("{}: {:.0f} s row by row {} SKIP_BLANKS".format(path, print_time(bits, skip_blanks), "with" if skip_blanks else "without"))
+    for name, flags, raster, plan in candidates(bits, True, True, previous):
+      size = len(encode_plan(plan)) if plan else 0
+      print("  {:<24} {:6.0f} s  plan of {} bytes{}".format(name, total_time(flags, raster, plan, skip_blanks), size,
+        ", too big" if size > PLAN_MAX_BYTES else ""))
+
+def usage():
+  print("To estimate the print time of an image, for every way to print it: planner.py <yourImage.png> ...")
+  print("To estimate it for the inverted image: planner.py -i <yourImage.png> ...")
+  print("To estimate it as an update of a previous post: planner.py -u <previous.png> <yourImage.png> ...")
+  print("To estimate it for a SKIP_BLANKS build: planner.py --skip-blanks <yourImage.png> ...")
+  print("To estimate the fills with measured timings: planner.py [--fill-brush-px 6] [--fill-sweep-ms 2000] [--fill-home-ms 4000] <yourImage.png> ...")
+
+if __name__ == "__main__":
+  if len(sys.argv[1:]) == 0:
+    usage()
+    sys.exit
+  else:
+    main(sys.argv[1:])
@@ -1,13 +1,27 @@
 #!/bin/python
 
 import sys, os, getopt
+from multiprocessing import Pool
+import numpy as np
 from PIL import Image
+from planner import print_time, choose_print, plan_pixels, encode_plan, text_plan, set_fill, IMAGE_NO_RASTER, FILL_OPTIONS
+from vector import svg_drawing, image_drawing, drawing_plan, drawing_time
 
 def main(argv):
-  opts, args = getopt.getopt(argv, "pshi")
+  opts, args = getopt.getopt(argv, "pshicb:d:q:emu:v", ["skip-blanks"] + FILL_OPTIONS)
   previewBilevel = False
   saveBilevel = False
   invertColormap = False
+  compress = False
+  batch = None
+  dither = "fs"
+  budget = 1.25
+  polarity = False
+  brushes = False
+  previous = None
+  vector = False
+  skip_blanks = False
+  fills = []
 
   for opt, arg in opts:
     if opt == '-h':
@@ -19,56 +33,302 @@ def main(argv):
       saveBilevel = True
     elif opt == '-i':
       invertColormap = True
+    elif opt == '-c':
+      compress = True
+    elif opt == '-b':
+      batch = arg
+    elif opt == '-d':
+      dither = arg
+    elif opt == '-q':
+      budget = float(arg)
+    elif opt == '-e':
+      polarity = True
+    elif opt == '-m':
+      brushes = True
+    elif opt == '-u':
+      previous = arg
+    elif opt == '-v':
+      vector = True
+    elif opt == '--skip-blanks':
+      skip_blanks = True
+    elif set_fill(opt, arg):
+      fills.append((opt, arg))
 
-  im = Image.open(args[0])                # import 320x120 png
-  if not (im.size[0] == 320 and im.size[1] == 120):
-    print("ERROR: Image must be 320px by 120px!")
+  if dither not in DITHERS:
+    print("ERROR: Unknown dithering mode " + dither + ", pick one of " + ", ".join(DITHERS))
     sys.exit()
 
-  im = im.convert("1")                    # convert to bilevel image
-                                          # dithering if necessary
-  if previewBilevel:
-    im.show()
-  if saveBilevel:
-    im.save("bilevel_" + args[0])
-    print("Bilevel version of " + args[0] + " saved as bilevel_" + args[0])
-  if not (previewBilevel or saveBilevel):
-    im_px = im.load()
-    data = []
-    for i in list(range(0,120)):                # iterate over the columns
-      for j in list(range(0,320)):              # and convert 255 vals to 0 to match logic in Joystick.c and invertColormap option
-         data.append(0 if im_px[j,i] == 255 else 1)
-
-    str_out = "// Converted: " + args[0] + "\n\n"
-    str_out += "#include <stdint.h>\n"
-    str_out += "#include <avr/pgmspace.h>\n\n"
-    str_out += "const uint8_t image_data[0x12c1] PROGMEM = {"
-    for i in list(range(0, 4800)):
-       val = 0;
-
-       for j in list(range(0, 8)):
-          val |= data[(i * 8) + j] << j
-
-       if (invertColormap):
-          val = ~val & 0xFF;
-       else:
-          val = val & 0xFF;
-
-       str_out += hex(val) + ", "         # append hexidecimal bytes
-                                          # to the output .c array
-    str_out += "0x0};\n"                  # of bytes
+  if previous is not None:
+    previous = image_bits(load(previous, invertColormap, dither, budget, skip_blanks), invertColormap)
+
+  if batch is not None:
+    convert_directory(batch, invertColormap, compress, dither, budget, polarity, brushes, previous, vector, skip_blanks, fills)
+    return
 
+  if len(args) > 1 and not compress:
+    print("Several images only fit in flash compressed, converting with -c")
+    compress = True
+
+  images = []
+  drawings = []
+  for path in args:
+    im, drawing = source(path, invertColormap, dither, budget, vector, skip_blanks)
+    if previewBilevel:
+      im.show()
+    if saveBilevel:
+      bilevel = "bilevel_" + os.path.splitext(path)[0] + ".png"
+      im.save(bilevel)
+      print("Bilevel version of " + path + " saved as " + bilevel)
+    images.append(im)
+    drawings.append(drawing)
+
+  if not (previewBilevel or saveBilevel):
+    str_out = convert(args, images, invertColormap, compress, polarity, brushes, previous, drawings, skip_blanks)
     with open('image.c', 'w') as f:       # save output into image.c
       f.write(str_out)
 
     if (invertColormap):
-       print("{} converted with inverted colormap and saved to image.c".format(args[0]))
+       print("{} converted with inverted colormap and saved to image.c".format(", ".join(args)))
     else:
-       print("{} converted with original colormap and saved to image.c".format(args[0]))
+       print("{} converted with original colormap and saved to image.c".format(", ".join(args)))
+
+def text_source(path):
+  # Plan writing a text post: the text in the file, after an optional first line "% scale [x y]" laying
+  # it out, otherwise as large as it fits and centered.
+  with open(path) as f:
+    lines = f.read().rstrip("\n").split("\n")
+  layout = []
+  if lines and lines[0].startswith("%"):
+    layout = [int(v) for v in lines.pop(0)[1:].split()]
+  return text_plan("\n".join(lines), *layout)
+
+def source(path, invertColormap, dither, budget, vector, skip_blanks=False):
+  # Bilevel image of a file, and for text posts and line drawings the plan drawing it: texts written
+  # on the printer, and strokes (see vector.py) for SVG drawings, and with vector the skeleton of the lines of an image.
+  if path.lower().endswith(".txt"):
+    drawing = text_source(path)
+  elif path.lower().endswith(".svg"):
+    drawing = drawing_plan(svg_drawing(path))
+  elif vector:
+    drawing = drawing_plan(image_drawing(image_bits(load(path, invertColormap, dither, budget, skip_blanks), invertColormap)), True)
+  else:
+    return load(path, invertColormap, dither, budget, skip_blanks), None
+  return Image.fromarray(plan_pixels(drawing) == 0), drawing
+
+def load(path, invertColormap=False, dither="fs", budget=1.25, skip_blanks=False):
+  im = Image.open(path)                   # import 320x120 png
+  if not (im.size[0] == 320 and im.size[1] == 120):
+    print("ERROR: Image must be 320px by 120px!")
+    sys.exit()
+
+  if dither == "fs":
+    return im.convert("1")                # convert to bilevel image
+                                          # dithering if necessary
+  return choose_dither(path, im, invertColormap, dither, budget, skip_blanks)
+
+# Bilevel conversions: name and parameters, as black pixel arrays from gray levels in 0..255.
+DITHERS = ["fs", "ordered", "diffuse", "threshold", "auto"]
+BAYER = np.array([[0, 32, 8, 40, 2, 34, 10, 42], [48, 16, 56, 24, 50, 18, 58, 26],
+                  [12, 44, 4, 36, 14, 46, 6, 38], [60, 28, 52, 20, 62, 30, 54, 22],
+                  [3, 35, 11, 43, 1, 33, 9, 41], [51, 19, 59, 27, 49, 17, 57, 25],
+                  [15, 47, 7, 39, 13, 45, 5, 37], [63, 31, 55, 23, 61, 29, 53, 21]])
+
+def dither_ordered(gray):
+  return (gray < (np.tile(BAYER, (15, 40)) + 0.5) * 4).astype(np.uint8)
+
+def dither_diffuse(gray, bias):
+  # Floyd-Steinberg, with the threshold moved by bias towards the pixel on the left: fewer, longer runs,
+  # and rows that stay blank longer, which the printer goes through faster.
+  error = gray.astype(np.float64)
+  black = np.zeros(gray.shape, np.uint8)
+  for y in range(0, 120):
+    row = error[y]
+    below = error[y + 1] if y < 119 else np.zeros(320)
+    left = 0
+    for x in range(0, 320):
+      old = row[x]
+      left = 1 if old < 128 + (bias if left else -bias) else 0
+      black[y, x] = left
+      err = old - (0 if left else 255)
+      if x < 319:
+        row[x + 1] += err * 7 / 16
+        below[x + 1] += err / 16
+      if x > 0:
+        below[x - 1] += err * 3 / 16
+      below[x] += err * 5 / 16
+  return black
+
+def dither_threshold(gray, level):
+  return (gray < level).astype(np.uint8)
+
+def dither_candidates(im, dither):
+  gray = np.asarray(im.convert("L"), dtype=np.float64)
+  if dither in ("ordered", "auto"):
+    yield "ordered", dither_ordered(gray)
+  if dither in ("diffuse", "auto"):
+    for bias in (0, 32, 64, 96):
+      yield "diffuse bias " + str(bias), dither_diffuse(gray, bias)
+  if dither in ("threshold", "auto"):
+    for level in range(16, 256, 16):
+      yield "threshold " + str(level), dither_threshold(gray, level)
+  if dither == "auto":
+    yield "fs", image_bits(im.convert("1"), False)
+
+def blur(image):
+  # Gaussian blur with a 1.5 pixels sigma, about what the eye averages at the usual viewing distance.
+  kernel = np.exp(-np.arange(-4, 5) ** 2 / (2 * 1.5 ** 2))
+  kernel /= kernel.sum()
+  padded = np.pad(image, 4, mode="edge")
+  rows = sum(k * padded[:, i:i + image.shape[1]] for i, k in enumerate(kernel))
+  return sum(k * rows[i:i + image.shape[0], :] for i, k in enumerate(kernel))
+
+def perceptual_error(gray, black):
+  # RMS difference between the blurred original and the blurred result, in percent of full scale.
+  return 100 * np.sqrt(np.mean((blur(gray / 255) - blur(1.0 - black)) ** 2))
+
+def choose_dither(path, im, invertColormap, dither, budget, skip_blanks):
+  # Score every candidate by print time and perceptual error, then keep the fastest one whose
+  # error is within budget times the lowest error.
+  gray = np.asarray(im.convert("L"), dtype=np.float64)
+  scored = []
+  for name, black in dither_candidates(im, dither):
+    scored.append((print_time(black ^ invertColormap, skip_blanks), perceptual_error(gray, black), name, black))
+  best = min(error for _, error, _, _ in scored)
+  chosen = min((s for s in scored if s[1] <= budget * best), key=lambda s: (s[0], s[1]))
+  print(path + ":")
+  for seconds, error, name, _ in scored:
+    print("  {} {:<18} {:6.0f} s  error {:5.2f}%".format("*" if name == chosen[2] else " ", name, seconds, error))
+  return Image.fromarray(chosen[3] == 0)
+
+def printed(name, im, invertColormap, polarity, brushes, previous, drawing=None, skip_blanks=False):
+  # Pixels left to the row by row pass, image flags and plan (see planner.py).
+  if drawing is not None:
+    plan = encode_plan(drawing)
+    print("{} is drawn by a plan of {} bytes in about {:.0f} s".format(name, len(plan), drawing_time(drawing)))
+    return np.zeros((120, 320), np.uint8), IMAGE_NO_RASTER, plan
+  bits = image_bits(im, invertColormap)
+  if not (polarity or brushes) and previous is None:
+    return bits, 0, None
+  way, flags, bits, plan, seconds = choose_print(bits, polarity, brushes, previous, skip_blanks)
+  print("{} is printed with {} in about {:.0f} s".format(name, way, seconds))
+  return bits, flags, plan
+
+def convert(names, images, invertColormap, compress, polarity=False, brushes=False, previous=None, drawings=None, skip_blanks=False):
+  # The whole image.c, for one raw image or any number of compressed ones.
+  out = ["// Converted: " + ", ".join(names) + "\n\n",
+         "#include <stdint.h>\n",
+         "#include <avr/pgmspace.h>\n\n"]
+  flags = []
+  plans = []
+  drawings = drawings or [None] * len(images)
+  if compress:
+    total = 0
+    for n, im in enumerate(images):
+      bits, flag, plan = printed(names[n], im, invertColormap, polarity, brushes, previous, drawings[n], skip_blanks)
+      flags.append(flag)
+      plans.append(plan)
+      if flag & IMAGE_NO_RASTER:
+        print("{} is printed by its plan alone, with no rows as image {}".format(names[n], n))
+        continue
+      rle = compress_rows(bits)
+      total += len(rle)
+      out += ["// " + names[n] + ": row-delta run lengths, build with IMAGE_RLE (see Bitmap.c).\n",
+              "static const uint8_t image_rle_" + str(n) + "[" + hex(len(rle)) + "] PROGMEM = {",
+              ", ".join(map(hex, rle)),
+              "};\n\n"]
+      print("{} compressed to {} bytes instead of 4801 as image {}".format(names[n], len(rle), n))
+      if len(rle) > 4801:
+        print("WARNING: Compressed image is larger than the raw one, heavily dithered images are better left raw!")
+    out += ["const uint8_t image_count PROGMEM = " + str(len(images)) + ";\n",
+            "const uint8_t* const image_table[" + str(len(images)) + "] PROGMEM = {",
+            ", ".join("0" if flags[n] & IMAGE_NO_RASTER else "image_rle_" + str(n) for n in range(0, len(images))),
+            "};\n"]
+    if len(images) > 1:
+      print("{} images, {} bytes in total".format(len(images), total))
+  else:
+    bits, flag, plan = printed(names[0], images[0], invertColormap, polarity, brushes, previous, drawings[0], skip_blanks)
+    flags.append(flag)
+    plans.append(plan)
+    out += ["const uint8_t image_data[0x12c1] PROGMEM = {",
+            "".join(hex(val) + ", " for val in pack_bits(bits).tolist()),
+            "0x0};\n"]
+  # Flags and plans of planner.py, see png2c.py -e, -m, -u and -v.
+  out += ["const uint8_t image_flags[" + str(len(images)) + "] PROGMEM = {",
+          ", ".join(hex(f) for f in flags),
+          "};\n"]
+  for n, plan in enumerate(plans):
+    if plan:
+      out += ["static const uint8_t image_plan_" + str(n) + "[" + hex(len(plan)) + "] PROGMEM = {",
+              ", ".join(map(hex, plan)),
+              "};\n"]
+  out += ["const uint8_t* const image_plan[" + str(len(images)) + "] PROGMEM = {",
+          ", ".join("image_plan_" + str(n) if plan else "0" for n, plan in enumerate(plans)),
+          "};\n"]
+  return "".join(out)
+
+def convert_file(job):
+  # Batch worker: yourImage.png to yourImage.c.
+  path, invertColormap, compress, dither, budget, polarity, brushes, previous, vector, skip_blanks, fills = job
+  # Workers don't share the module state of the main process with every start method.
+  for opt, arg in fills:
+    set_fill(opt, arg)
+  im, drawing = source(path, invertColormap, dither, budget, vector, skip_blanks)
+  with open(os.path.splitext(path)[0] + ".c", 'w') as f:
+    f.write(convert([os.path.basename(path)], [im], invertColormap, compress, polarity, brushes, previous, [drawing], skip_blanks))
+  return path
+
+def convert_directory(directory, invertColormap, compress, dither, budget, polarity, brushes, previous, vector, skip_blanks, fills):
+  paths = sorted(os.path.join(directory, name) for name in os.listdir(directory) if name.lower().endswith((".png", ".svg", ".txt")))
+  with Pool() as pool:
+    for path in pool.imap_unordered(convert_file, [(path, invertColormap, compress, dither, budget, polarity, brushes, previous, vector, skip_blanks, fills) for path in paths]):
+      print(path + " converted to " + os.path.splitext(path)[0] + ".c")
+
+def image_bits(im, invertColormap):
+  # 120x320 array, 1 where the printer inks: black pixels, or white ones with invertColormap.
+  data = (np.asarray(im, dtype=np.uint8) == 0).astype(np.uint8)
+  if (invertColormap):
+    data ^= 1
+  return data
+
+def pack_bits(data):
+  # 8 pixels per byte, the leftmost one in the lowest bit, as read by Bitmap.c.
+  return np.packbits(data.reshape(-1), bitorder='little')
+
+def encode_runs(runs):
+  # One byte below 128, otherwise two bytes big endian with the top bit set.
+  runs = np.asarray(runs)
+  long = runs >= 0x80
+  at = np.cumsum(1 + long) - (1 + long)
+  out = np.empty(len(runs) + np.count_nonzero(long), np.int64)
+  out[at] = np.where(long, 0x80 | (runs >> 8), runs)
+  out[at[long] + 1] = runs[long] & 0xFF
+  return out.tolist()
+
+def compress_rows(data):
+  # Every row as run lengths of pixels alternately unchanged and flipped from the row above,
+  # starting with an unchanged run. The row above the first one is white.
+  changed = data ^ np.vstack((np.zeros((1, 320), np.uint8), data[:-1]))
+  runs = []
+  for row in changed:
+    # Runs end wherever a pixel is not changed the same way as the one on its left.
+    ends = np.flatnonzero(np.diff(row, prepend=0))
+    runs.append(np.diff(ends, prepend=0, append=320))
+  return encode_runs(np.concatenate(runs))
 
 def usage():
   print("To convert to image.c: png2c.py <yourImage.png>")
   print("To convert to an inverted image.c: png2c.py -i <yourImage.png>")
+  print("To convert to a compressed image.c, for IMAGE_RLE builds: png2c.py -c <yourImage.png>")
+  print("To pack several images into a compressed image.c, selected at boot: png2c.py <first.png> <second.png> ...")
+  print("To convert every .png of a directory to a .c file next to it, in parallel: png2c.py -b <directory>")
+  print("To dither for a faster print (see planner.py): png2c.py -d <ordered|diffuse|threshold|auto> [-q <error budget, times the lowest error, 1.25>] <yourImage.png>")
+  print("To fill the canvas and erase the white pixels when it is faster, for SKIP_BLANKS builds: png2c.py -e --skip-blanks <yourImage.png>")
+  print("To estimate the print times for a SKIP_BLANKS build, as the other options do: png2c.py --skip-blanks ...")
+  print("To estimate the fills of -e and -m with measured timings (see planner.py): png2c.py [--fill-brush-px 6] [--fill-sweep-ms 2000] [--fill-home-ms 4000] ...")
+  print("To cover solid areas with the large brush, or draw with strokes, when it is faster: png2c.py -m <yourImage.png>")
+  print("To only change what differs from the post on the canvas, when it is faster: png2c.py -u <previous.png> <yourImage.png>")
+  print("To draw a line drawing with strokes: png2c.py -c <yourDrawing.svg>, or png2c.py -c -v <yourImage.png> for the skeleton of its lines")
+  print("To write a text post with the font of the printer: png2c.py -c <yourText.txt>, optionally laid out by a first line \"% scale [x y]\"")
   print("To preview bilevel image: png2c.py -p <yourImage.png>")
   print("To save bilevel image: png2c.py -s <yourImage.png>")
 
@@ -0,0 +1,131 @@
+#!/bin/python
+
+import sys, os, getopt, threading, time, termios, tty
+from PIL import Image
+from png2c import image_bits, pack_bits
+
+# Must match Uart.h and Bitmap.h.
+UART_ENQ = 0x05
+UART_ACK = 0x06
+UART_CREDIT_BYTES = 16
+UART_RING_SIZE = 128
+ROW_BYTES = 40
+
+def load(path, invertColormap):
+  # Raw 1bpp rows, as image_data in the image.c made by png2c.py.
+  im = Image.open(path)
+  if not (im.size[0] == 320 and im.size[1] == 120):
+    print("ERROR: Image must be 320px by 120px!")
+    sys.exit(1)
+  return pack_bits(image_bits(im.convert("1"), invertColormap)).tobytes()
+
+def open_port(path, baud):
+  fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+  tty.setraw(fd)
+  attrs = termios.tcgetattr(fd)
+  speed = getattr(termios, "B" + str(baud))
+  attrs[4] = speed
+  attrs[5] = speed
+  termios.tcsetattr(fd, termios.TCSANOW, attrs)
+  return fd
+
+def send(fd, data, verbose):
+  # Wait for the printer to ask for an image, then only send what it has room for.
+  # A new request in the middle means it restarted, so start over.
+  while os.read(fd, 1)[0] != UART_ENQ:
+    pass
+  sent = 0
+  credits = UART_RING_SIZE // UART_CREDIT_BYTES
+  while sent < len(data):
+    while credits > 0 and sent < len(data):
+      os.write(fd, data[sent:sent + UART_CREDIT_BYTES])
+      sent += UART_CREDIT_BYTES
+      credits -= 1
+    if sent < len(data):
+      for byte in os.read(fd, 64):
+        if byte == UART_ACK:
+          credits += 1
+        elif byte == UART_ENQ:
+          print("Printer restarted, sending the image again")
+          sent = 0
+          credits = UART_RING_SIZE // UART_CREDIT_BYTES
+    if verbose:
+      print("\rrow {}/120".format(sent // ROW_BYTES), end="", flush=True)
+  if verbose:
+    print()
+
+def emulate(fd, images, row_ms):
+  # Stand-in for the firmware on the other end of a pty: asks for every image in turn, and takes
+  # the rows out of a ring as a printer would. Fails if the sender ever overflows the ring.
+  for expected in images:
+    os.write(fd, bytes([UART_ENQ]))
+    ring = bytearray()
+    image = bytearray()
+    consumed = 0
+    while len(image) < len(expected):
+      ring += os.read(fd, 256)
+      if len(ring) > UART_RING_SIZE:
+        print("ERROR: Ring overflow, {} bytes waiting".format(len(ring)))
+        os._exit(1)
+      # Bitmap_Begin needs two rows, Bitmap_NextRow one.
+      while len(ring) >= (2 * ROW_BYTES if not image else ROW_BYTES) and len(image) < len(expected):
+        time.sleep(row_ms / 1000)
+        image += ring[:ROW_BYTES]
+        del ring[:ROW_BYTES]
+        consumed += ROW_BYTES
+        os.write(fd, bytes([UART_ACK]) * (consumed // UART_CREDIT_BYTES))
+        consumed %= UART_CREDIT_BYTES
+    print("Emulated printer: image {}".format("received" if image == expected else "CORRUPTED"))
+
+def main(argv):
+  opts, args = getopt.getopt(argv, "hd:b:iev")
+  device = "/dev/ttyUSB0"
+  baud = 115200
+  invertColormap = False
+  emulated = False
+  verbose = False
+
+  for opt, arg in opts:
+    if opt == '-h':
+      usage()
+      sys.exit()
+    elif opt == '-d':
+      device = arg
+    elif opt == '-b':
+      baud = int(arg)
+    elif opt == '-i':
+      invertColormap = True
+    elif opt == '-e':
+      emulated = True
+    elif opt == '-v':
+      verbose = True
+
+  images = [load(path, invertColormap) for path in args]
+
+  if emulated:
+    master, slave = os.openpty()
+    device = os.ttyname(slave)
+    printer = threading.Thread(target=emulate, args=(master, images, 2))
+    printer.start()
+
+  fd = open_port(device, baud)
+  for n, path in enumerate(args):
+    if n > 0:
+      print("Reset the printer for the next image")
+    send(fd, images[n], verbose)
+    print("{} sent".format(path))
+  if emulated:
+    printer.join()
+
+def usage():
+  print("To stream images to an IMAGE_UART printer, one per print: png2uart.py [-d /dev/ttyUSB0] [-b 115200] <yourImage.png> ...")
+  print("To stream an inverted image: png2uart.py -i <yourImage.png>")
+  print("To try the protocol against an emulated printer on a pty: png2uart.py -e <yourImage.png>")
+  print("To show the progress: png2uart.py -v <yourImage.png>")
+
+if __name__ == "__main__":
+  if len(sys.argv[1:]) == 0:
+    usage()
+    sys.exit
+  else:
+    main(sys.argv[1:])
@@ -0,0 +1,89 @@
+#!/bin/python
+
+import sys, os, getopt, struct, time, tty
+
+# Must match Telemetry.h and Joystick.c.
+TELEMETRY_SYNC = 0xA5
+TELEMETRY_STATE = 0x01
+TELEMETRY_REPORTS = 0x02
+TELEMETRY_FEEDBACK = 0x03
+TELEMETRY_REPLY = 0x04
+RECORD = "<BBBBIHH"
+STATES = ["SYNC_CONTROLLER", "SYNC_POSITION", "STOP_X", "STOP_Y", "MOVE_X", "MOVE_Y", "DONE", "PLAN"]
+
+def state_name(state):
+  return STATES[state] if state < len(STATES) else str(state)
+
+def records(fd):
+  # Whole records out of the stream, skipping bytes until a sync byte starts a known record type.
+  size = struct.calcsize(RECORD)
+  data = bytearray()
+  while True:
+    data += os.read(fd, 256)
+    while len(data) >= size:
+      if data[0] != TELEMETRY_SYNC or not TELEMETRY_STATE <= data[1] <= TELEMETRY_REPLY:
+        del data[0]
+        continue
+      yield struct.unpack(RECORD, bytes(data[:size]))
+      del data[:size]
+
+def show(record, start):
+  sync, kind, state, arg, micros, a, b = record
+  at = "{:10.3f} {:15}".format((micros - start) % 2 ** 32 / 1e6, state_name(state))
+  if kind == TELEMETRY_STATE:
+    print("{} entered from {} at {}, {}".format(at, state_name(arg), a, b))
+  elif kind == TELEMETRY_REPORTS:
+    print("{} {} reports/s, longest IN interval {:.3f} ms{}".format(at, a, b / 1000, ", {} records dropped".format(arg) if arg else ""))
+  elif kind == TELEMETRY_FEEDBACK:
+    print("{} OUT feedback: {} acknowledged, {} timed out".format(at, a, b))
+  elif kind == TELEMETRY_REPLY:
+    print("{} reply to '{}': {}, {}".format(at, chr(arg), a, b))
+
+def main(argv):
+  opts, args = getopt.getopt(argv, "hd:e:srt:")
+  device = "/dev/ttyACM0"
+  commands = []
+  seconds = None
+
+  for opt, arg in opts:
+    if opt == '-h':
+      usage()
+      sys.exit()
+    elif opt == '-d':
+      device = arg
+    elif opt == '-e':
+      commands.append(b"e" + bytes([int(arg)]))
+    elif opt == '-s':
+      commands.append(b"s\0")
+    elif opt == '-r':
+      commands.append(b"r\0")
+    elif opt == '-t':
+      seconds = float(arg)
+
+  # Opening the port raises DTR, which starts the stream.
+  fd = os.open(device, os.O_RDWR | os.O_NOCTTY)
+  tty.setraw(fd)
+  for command in commands:
+    os.write(fd, command)
+
+  start = None
+  end = time.time() + seconds if seconds is not None else None
+  try:
+    for record in records(fd):
+      if start is None:
+        start = record[4]
+      show(record, start)
+      if end is not None and time.time() > end:
+        break
+  except KeyboardInterrupt:
+    pass
+
+def usage():
+  print("To show the telemetry of a TELEMETRY build: telemetry.py [-d /dev/ttyACM0]")
+  print("To stop after a while: telemetry.py -t <seconds>")
+  print("To clear the statistics first: telemetry.py -r")
+  print("To ask where the cursor is: telemetry.py -s")
+  print("To set the number of echoes until the next boot: telemetry.py -e <echoes>")
+
+if __name__ == "__main__":
+  main(sys.argv[1:])
@@ -0,0 +1,122 @@
+/** \file
+ *
+ *  Host stress test of Ring.h: one producer thread and one consumer thread pass numbered items
+ *  through small rings, many times around their 8-bit indices, and the consumer checks that
+ *  every item comes out once, in order and intact. Each side yields while the ring is full or
+ *  empty. Both the copying and the zero-copy forms are run. Build and run with "make test".
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "Ring.h"
+
+// Items through each ring, some 7800 turns of the 8-bit indices.
+#define ITEMS 2000000UL
+
+typedef struct {
+	uint32_t Seq;
+	uint32_t Check;
+	uint8_t  Bytes[8];
+} Item_t;
+
+RING_DEFINE(SmallRing, Item_t, 4)
+RING_DEFINE(LargeRing, Item_t, 128)
+
+static void Fill(Item_t* const item, const uint32_t seq)
+{
+	item->Seq = seq;
+	item->Check = seq * 2654435761U;
+	for (uint8_t i = 0; i < sizeof(item->Bytes); i++)
+		item->Bytes[i] = (uint8_t)(seq >> i) ^ i;
+}
+
+static bool Valid(const Item_t* const item, const uint32_t seq)
+{
+	if (item->Seq != seq || item->Check != seq * 2654435761U)
+		return false;
+	for (uint8_t i = 0; i < sizeof(item->Bytes); i++)
+		if (item->Bytes[i] != ((uint8_t)(seq >> i) ^ i))
+			return false;
+	return true;
+}
+
+// One producer and one consumer per ring kind and API, the consumer counting what went wrong.
+#define STRESS(name)                                                              \
+	static name##_t name##_ring;                                                  \
+	                                                                              \
+	static void* name##_Copying(void* arg)                                        \
+	{                                                                             \
+		(void)arg;                                                                \
+		Item_t item;                                                              \
+		for (uint32_t seq = 0; seq < ITEMS; seq++)                                \
+		{                                                                         \
+			Fill(&item, seq);                                                     \
+			while (!name##_Push(&name##_ring, &item)) sched_yield();                            \
+		}                                                                         \
+		return NULL;                                                              \
+	}                                                                             \
+	                                                                              \
+	static void* name##_ZeroCopy(void* arg)                                       \
+	{                                                                             \
+		(void)arg;                                                                \
+		for (uint32_t seq = 0; seq < ITEMS; seq++)                                \
+		{                                                                         \
+			Item_t* item;                                                         \
+			while (!(item = name##_Reserve(&name##_ring))) sched_yield();                       \
+			Fill(item, seq);                                                      \
+			name##_Commit(&name##_ring);                                          \
+		}                                                                         \
+		return NULL;                                                              \
+	}                                                                             \
+	                                                                              \
+	static unsigned long name##_Consume(const bool zero_copy)                     \
+	{                                                                             \
+		unsigned long errors = 0;                                                 \
+		for (uint32_t seq = 0; seq < ITEMS; seq++)                                \
+		{                                                                         \
+			if (zero_copy)                                                        \
+			{                                                                     \
+				Item_t* item;                                                     \
+				while (!(item = name##_Peek(&name##_ring))) sched_yield();                      \
+				errors += !Valid(item, seq);                                      \
+				name##_Release(&name##_ring);                                     \
+			}                                                                     \
+			else                                                                  \
+			{                                                                     \
+				Item_t item;                                                      \
+				while (!name##_Pop(&name##_ring, &item)) sched_yield();                         \
+				errors += !Valid(&item, seq);                                     \
+			}                                                                     \
+		}                                                                         \
+		return errors + (name##_Count(&name##_ring) != 0);                        \
+	}                                                                             \
+	                                                                              \
+	static unsigned long name##_Run(const bool zero_copy)                         \
+	{                                                                             \
+		pthread_t producer;                                                       \
+		pthread_create(&producer, NULL, zero_copy ? name##_ZeroCopy : name##_Copying, NULL); \
+		unsigned long errors = name##_Consume(zero_copy);                         \
+		pthread_join(producer, NULL);                                             \
+		return errors;                                                            \
+	}
+
+STRESS(SmallRing)
+STRESS(LargeRing)
+
+int main(void)
+{
+	unsigned long failures = 0;
+	const char* names[] = {"copying", "zero-copy"};
+	for (int zero_copy = 0; zero_copy < 2; zero_copy++)
+	{
+		unsigned long small = SmallRing_Run(zero_copy);
+		unsigned long large = LargeRing_Run(zero_copy);
+		printf("%-9s  4 items: %lu errors, 128 items: %lu errors in %lu items\n", names[zero_copy], small, large, ITEMS);
+		failures += small + large;
+	}
+	printf(failures ? "FAILED\n" : "passed\n");
+	return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,161 @@
+#!/bin/python
+
+import sys, getopt, math, re
+
+# Must match State_t and TraceEvent_t in Joystick.c.
+STATES = ["SYNC_CONTROLLER", "SYNC_POSITION", "STOP_X", "STOP_Y", "MOVE_X", "MOVE_Y", "DONE", "PLAN"]
+EVENTS = ["ECHO", "MOVE", "ENTER", "INK"]
+
+# Trace pins on PORTB (see Oscilloscope_A/B, Trace_State and Trace_Event in Joystick.c).
+PIN_IN = 1
+PIN_OUT = 2
+PINS_STATE = [4, 5, 6]
+PINS_EVENT = [0, 7]
+
+def parse_rate(text):
+  # Accepts "24 MHz", "1MHz", "500kHz" or a plain number of Hz.
+  match = re.match(r"\s*([0-9.]+)\s*([kMG]?)", text)
+  return float(match.group(1)) * {"": 1, "k": 1e3, "M": 1e6, "G": 1e9}[match.group(2)]
+
+def read_samples(path, channels, samplerate):
+  # Yields (time, [PB0..PB7]) for every line of a sigrok/PulseView CSV export.
+  columns = None
+  time_col = None
+  index = 0
+  with open(path) as f:
+    for line in f:
+      line = line.strip()
+      if not line:
+        continue
+      if line.startswith(";"):
+        if "Samplerate:" in line and samplerate is None:
+          samplerate = parse_rate(line.split("Samplerate:")[1])
+        continue
+      fields = [x.strip() for x in line.split(",")]
+      if columns is None:
+        try:
+          float(fields[0])
+        except ValueError:
+          names = [x.split()[0] if x else x for x in fields]
+          for i, name in enumerate(names):
+            if name.lower().startswith("time"):
+              time_col = i
+          columns = [names.index(c) for c in channels]
+          continue
+        columns = [int(c[1:]) if c[0] in "dD" else int(c) for c in channels]
+      if time_col is not None:
+        t = float(fields[time_col])
+      else:
+        if samplerate is None:
+          print("ERROR: No time column and no samplerate, use -r <Hz>!")
+          sys.exit(1)
+        t = index / samplerate
+      index += 1
+      yield t, [fields[c] == "1" for c in columns]
+
+def bits(levels, pins):
+  value = 0
+  for i, pin in enumerate(pins):
+    if levels[pin]:
+      value |= 1 << i
+  return value
+
+def percentile(values, p):
+  return values[min(len(values) - 1, int(p * len(values)))]
+
+def main(argv):
+  opts, args = getopt.getopt(argv, "hr:c:s:v")
+  samplerate = None
+  channels = ["D%d" % i for i in range(8)]
+  stallFactor = 1.5
+  verbose = False
+
+  for opt, arg in opts:
+    if opt == '-h':
+      usage()
+      sys.exit()
+    elif opt == '-r':
+      samplerate = parse_rate(arg)
+    elif opt == '-c':
+      channels = arg.split(",")
+      if len(channels) != 8:
+        print("ERROR: -c needs 8 channel names, PB0 to PB7!")
+        sys.exit(1)
+    elif opt == '-s':
+      stallFactor = float(arg)
+    elif opt == '-v':
+      verbose = True
+
+  if len(args) != 1:
+    usage()
+    sys.exit(1)
+
+  prev = None
+  packets = []                            # (time, state, event) at every IN packet
+  outs = 0
+  for t, levels in read_samples(args[0], channels, samplerate):
+    if prev is not None:
+      if levels[PIN_IN] != prev[PIN_IN]:
+        packets.append((t, bits(levels, PINS_STATE), bits(levels, PINS_EVENT)))
+      if levels[PIN_OUT] != prev[PIN_OUT]:
+        outs += 1
+    prev = levels
+
+  if len(packets) < 2:
+    print("ERROR: Less than two IN packets found, check the channel mapping!")
+    sys.exit(1)
+
+  # State timeline: every packet accounts for the time until the next one.
+  durations = [0.0] * len(STATES)
+  reports = [0] * len(STATES)
+  events = [0] * len(EVENTS)
+  timeline = []
+  for (t, s, e), (t_next, _, _) in zip(packets, packets[1:]):
+    durations[s] += t_next - t
+    reports[s] += 1
+    events[e] += 1
+    if not timeline or timeline[-1][1] != s:
+      timeline.append((t, s))
+
+  intervals = sorted(b[0] - a[0] for a, b in zip(packets, packets[1:]))
+  mean = sum(intervals) / len(intervals)
+  jitter = math.sqrt(sum((x - mean) ** 2 for x in intervals) / len(intervals))
+  median = percentile(intervals, 0.5)
+  stalls = [(a[0], b[0] - a[0], a[1]) for a, b in zip(packets, packets[1:]) if b[0] - a[0] > median * stallFactor]
+
+  print("Capture: {:.3f} s, {} IN packets, {} OUT packets".format(packets[-1][0] - packets[0][0], len(packets), outs))
+  print("")
+  print("IN interval (ms): mean {:.3f}, jitter {:.3f}, min {:.3f}, p50 {:.3f}, p99 {:.3f}, max {:.3f}".format(
+    mean * 1e3, jitter * 1e3, intervals[0] * 1e3, median * 1e3, percentile(intervals, 0.99) * 1e3, intervals[-1] * 1e3))
+  print("Stalls (> {:.1f}x median): {}, {:.3f} s lost".format(stallFactor, len(stalls), sum(d - median for _, d, _ in stalls)))
+  print("")
+  print("{:<16} {:>10} {:>10}".format("State", "Time (s)", "Reports"))
+  for s, name in enumerate(STATES):
+    if reports[s]:
+      print("{:<16} {:>10.3f} {:>10}".format(name, durations[s], reports[s]))
+  print("")
+  print("Events: " + ", ".join("{} {}".format(name, events[e]) for e, name in enumerate(EVENTS)))
+
+  if verbose:
+    print("")
+    print("Timeline:")
+    for t, s in timeline:
+      print("{:>12.6f} {}".format(t, STATES[s]))
+    print("")
+    print("Stalls:")
+    for t, d, s in stalls:
+      print("{:>12.6f} {:>8.3f} ms in {}".format(t, d * 1e3, STATES[s]))
+
+def usage():
+  print("To decode a sigrok/PulseView CSV export of a TRACE_STATES build: trace2timeline.py <capture.csv>")
+  print("To set the samplerate when the export has no time column: trace2timeline.py -r 1MHz <capture.csv>")
+  print("To name the channels wired to PB0..PB7: trace2timeline.py -c D0,D1,D2,D3,D4,D5,D6,D7 <capture.csv>")
+  print("To flag IN intervals longer than 2x the median as stalls: trace2timeline.py -s 2 <capture.csv>")
+  print("To also list the state timeline and every stall: trace2timeline.py -v <capture.csv>")
+
+if __name__ == "__main__":
+  if len(sys.argv[1:]) == 0:
+    usage()
+    sys.exit
+  else:
+    main(sys.argv[1:])
@@ -0,0 +1,139 @@
+#!/bin/python
+
+import sys, os, getopt, glob, struct, fcntl, time
+
+# Must match Joystick.h, Profiler.h and Settings.h.
+FEATURE_PROGRESS = 0x01
+FEATURE_POLL = 0x02
+FEATURE_LATENCY = 0x03
+FEATURE_PIPELINE = 0x04
+FEATURE_TIMINGS = 0x05
+FEATURE_IMAGE = 0x06
+PROGRESS = "<BHHHIHH"
+POLL = "<IIHH16H"
+LATENCY = "<IIH"
+PIPELINE = "<5H5I5H"
+TIMINGS = "<BHHH"
+STATES = ["SYNC_CONTROLLER", "SYNC_POSITION", "STOP_X", "STOP_Y", "MOVE_X", "MOVE_Y", "DONE", "PLAN"]
+# Timer1 ticks per ms at 16 MHz, see Timer.h.
+TICKS_PER_MS = 2000
+# USB IDs of the Pokken controller, see Descriptors.c.
+HID_ID = "0003:00000F0D:00000092"
+
+def ioctl_feature(number, size):
+  # HIDIOCSFEATURE and HIDIOCGFEATURE of linux/hidraw.h: _IOC(_IOC_WRITE | _IOC_READ, 'H', number, size).
+  return (3 << 30) | (size << 16) | (ord('H') << 8) | number
+
+def find_device():
+  for path in sorted(glob.glob("/sys/class/hidraw/hidraw*")):
+    with open(os.path.join(path, "device", "uevent")) as uevent:
+      if "HID_ID=" + HID_ID in uevent.read().upper():
+        return os.path.join("/dev", os.path.basename(path))
+  print("ERROR: No printer found, give its hidraw device with -d")
+  sys.exit(1)
+
+def get_feature(fd, report, layout):
+  # The reply starts with the report ID, as the request.
+  buf = bytearray([report]) + bytearray(struct.calcsize(layout))
+  fcntl.ioctl(fd, ioctl_feature(0x07, len(buf)), buf, True)
+  return struct.unpack(layout, bytes(buf[1:]))
+
+def set_feature(fd, report, layout, *values):
+  buf = bytearray([report]) + struct.pack(layout, *values)
+  fcntl.ioctl(fd, ioctl_feature(0x06, len(buf)), buf, True)
+
+def show_progress(fd):
+  state, x, y, reports, millis, acks, timeouts = get_feature(fd, FEATURE_PROGRESS, PROGRESS)
+  name = STATES[state] if state < len(STATES) else str(state)
+  print("{} at {}, {} after {} reports, {:.1f} s since boot".format(name, x, y, reports, millis / 1000))
+  if acks or timeouts:
+    print("  OUT feedback: {} reports acknowledged, {} timed out".format(acks, timeouts))
+
+def show_timings(fd):
+  echoes, pairing, clear, home = get_feature(fd, FEATURE_TIMINGS, TIMINGS)
+  print("Echoes {}, pairing presses {} ms apart, canvas clear presses {} ms apart, home in {} ms".format(echoes, pairing, clear, home))
+  print("Image {}".format(get_feature(fd, FEATURE_IMAGE, "<B")[0]))
+
+def show_stats(fd):
+  values = get_feature(fd, FEATURE_POLL, POLL)
+  reports, total, shortest, longest = values[:4]
+  if reports:
+    print("Poll intervals: {} recorded, mean {:.3f} ms, min {:.3f} ms, max {:.3f} ms".format(reports,
+      total / reports / TICKS_PER_MS, shortest / TICKS_PER_MS, longest / TICKS_PER_MS))
+    print("  per ms: " + " ".join(str(count) for count in values[4:]))
+  else:
+    print("Poll intervals: none recorded, build with PROFILE")
+  samples, total, longest = get_feature(fd, FEATURE_LATENCY, LATENCY)
+  if samples:
+    print("Input latency: {} recorded, mean {:.3f} ms, max {:.3f} ms".format(samples, total / samples / TICKS_PER_MS, longest / TICKS_PER_MS))
+  values = get_feature(fd, FEATURE_PIPELINE, PIPELINE)
+  for stage in range(0, 5):
+    runs, total, longest = values[stage], values[5 + stage], values[10 + stage]
+    if runs:
+      print("Stage {}: {} runs, mean {:.1f} us, max {:.1f} us".format(stage, runs, total / runs * 1000 / TICKS_PER_MS, longest * 1000 / TICKS_PER_MS))
+
+def main(argv):
+  opts, args = getopt.getopt(argv, "hd:sce:t:n:w:")
+  device = None
+  stats = False
+  clear = False
+  echoes = None
+  times = None
+  image = None
+  watch = None
+
+  for opt, arg in opts:
+    if opt == '-h':
+      usage()
+      sys.exit()
+    elif opt == '-d':
+      device = arg
+    elif opt == '-s':
+      stats = True
+    elif opt == '-c':
+      clear = True
+    elif opt == '-e':
+      echoes = int(arg)
+    elif opt == '-t':
+      times = [int(ms) for ms in arg.split(",")]
+    elif opt == '-n':
+      image = int(arg)
+    elif opt == '-w':
+      watch = float(arg)
+
+  fd = os.open(device or find_device(), os.O_RDWR)
+
+  if echoes is not None or times is not None:
+    current = list(get_feature(fd, FEATURE_TIMINGS, TIMINGS))
+    if echoes is not None:
+      current[0] = echoes
+    if times is not None:
+      current[1:1 + len(times)] = times
+    set_feature(fd, FEATURE_TIMINGS, TIMINGS, *current)
+    # Timings the printer doesn't take are left as they were.
+    if list(get_feature(fd, FEATURE_TIMINGS, TIMINGS)) != current:
+      print("ERROR: Timings refused, the canvas clear presses must both come before home")
+  if image is not None:
+    set_feature(fd, FEATURE_IMAGE, "<B", image)
+  if clear:
+    set_feature(fd, FEATURE_POLL, "")
+
+  show_timings(fd)
+  while True:
+    show_progress(fd)
+    if stats:
+      show_stats(fd)
+    if watch is None:
+      break
+    time.sleep(watch)
+
+def usage():
+  print("To show where the print is and the timings: tune.py [-d /dev/hidraw0]")
+  print("To also show the PROFILE statistics: tune.py -s")
+  print("To clear the statistics: tune.py -c")
+  print("To save new timings, used from the next report: tune.py [-e echoes] [-t pairing_ms[,clear_ms[,home_ms]]]")
+  print("To save the image to print from the next boot: tune.py -n <index>")
+  print("To show the progress every few seconds: tune.py -w <seconds>")
+
+if __name__ == "__main__":
+  main(sys.argv[1:])
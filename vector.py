@@ -0,0 +1,269 @@
+#!/bin/python
+
+import sys, getopt, re, math
+import xml.etree.ElementTree as ElementTree
+import numpy as np
+from planner import WIDTH, HEIGHT, plan_steps, plan_pixels, stroke_steps, encode_plan, report_ms, SYNC_MS
+
+# Longest stroke in one plan command, along either axis.
+STROKE_MAX = 127
+# Points per quarter turn of the circles, ellipses and curves of SVG drawings.
+CURVE_POINTS = 8
+
+# A drawing is a list of polylines, each a list of (x, y) canvas pixels, every one drawn holding A
+# from its first point, straight from point to point as the PLAN state strokes (see stroke_steps).
+
+def skeleton(bits):
+  # Zhang-Suen thinning: one pixel wide lines along the middle of the strokes of a line drawing.
+  image = np.pad(bits.astype(np.uint8), 1)
+  while True:
+    thinned = False
+    for step in (0, 1):
+      p2, p3, p4 = image[:-2, 1:-1], image[:-2, 2:], image[1:-1, 2:]
+      p5, p6, p7 = image[2:, 2:], image[2:, 1:-1], image[2:, :-2]
+      p8, p9 = image[1:-1, :-2], image[:-2, :-2]
+      around = [p2, p3, p4, p5, p6, p7, p8, p9, p2]
+      neighbours = sum(around[:-1])
+      crossings = sum(((a == 0) & (b == 1)).astype(np.uint8) for a, b in zip(around[:-1], around[1:]))
+      if step == 0:
+        ends = (p2 * p4 * p6 == 0) & (p4 * p6 * p8 == 0)
+      else:
+        ends = (p2 * p4 * p8 == 0) & (p2 * p6 * p8 == 0)
+      remove = (image[1:-1, 1:-1] == 1) & (neighbours >= 2) & (neighbours <= 6) & (crossings == 1) & ends
+      if remove.any():
+        image[1:-1, 1:-1][remove] = 0
+        thinned = True
+    if not thinned:
+      return image[1:-1, 1:-1]
+
+NEIGHBOURS = [(1, 0), (0, 1), (-1, 0), (0, -1), (1, 1), (-1, 1), (-1, -1), (1, -1)]
+
+def trace(bits):
+  # Pixel paths going once through every pixel set, each step to one of the 8 neighbours.
+  # Paths start from line ends, and keep going straight when they can.
+  left = {(int(x), int(y)) for y, x in np.argwhere(bits)}
+  def degree(p):
+    return sum((p[0] + dx, p[1] + dy) in left for dx, dy in NEIGHBOURS)
+  paths = []
+  while left:
+    start = min(left, key=lambda p: (degree(p), p[1], p[0]))
+    left.discard(start)
+    path = [start]
+    way = (1, 0)
+    while True:
+      x, y = path[-1]
+      nexts = [d for d in [way] + NEIGHBOURS if (x + d[0], y + d[1]) in left]
+      if not nexts:
+        break
+      way = nexts[0]
+      path.append((x + way[0], y + way[1]))
+      left.discard(path[-1])
+    paths.append(path)
+  return paths
+
+def fit(path):
+  # Fewest points whose strokes go through exactly the pixels of the path, in order.
+  points = [path[0]]
+  i = 0
+  while i < len(path) - 1:
+    best = i + 1
+    for j in range(i + 2, len(path)):
+      dx, dy = path[j][0] - path[i][0], path[j][1] - path[i][1]
+      if max(abs(dx), abs(dy)) > STROKE_MAX:
+        break
+      if [(path[i][0] + sx, path[i][1] + sy) for sx, sy in stroke_steps(dx, dy)] != path[i + 1:j + 1]:
+        break
+      best = j
+    points.append(path[best])
+    i = best
+  return points
+
+def image_drawing(bits):
+  # Pixel paths along the skeleton of a line drawing, fitted with strokes once routed.
+  return trace(skeleton(bits))
+
+def svg_length(value):
+  return float(re.match(r"[-+]?[0-9.]+(?:[eE][-+]?[0-9]+)?", value).group(0))
+
+def arc(cx, cy, rx, ry):
+  # Closed polygon around an ellipse.
+  turns = 4 * CURVE_POINTS
+  return [(cx + rx * np.cos(2 * np.pi * k / turns), cy + ry * np.sin(2 * np.pi * k / turns)) for k in range(0, turns + 1)]
+
+def bezier(points):
+  # Points along a quadratic or cubic Bezier curve, without the first one.
+  t = np.linspace(0, 1, CURVE_POINTS + 1)[1:]
+  n = len(points) - 1
+  weights = [math.comb(n, k) * (1 - t) ** (n - k) * t ** k for k in range(0, n + 1)]
+  return list(zip(sum(w * p[0] for w, p in zip(weights, points)), sum(w * p[1] for w, p in zip(weights, points))))
+
+def path_polylines(d):
+  # Polylines of an SVG path: moves, lines and Bezier curves, absolute or relative. Arcs are drawn straight.
+  tokens = re.findall(r"[MmLlHhVvCcSsQqTtAaZz]|[-+]?(?:[0-9]+\.?[0-9]*|\.[0-9]+)(?:[eE][-+]?[0-9]+)?", d)
+  polylines = []
+  x = y = 0
+  start = (0, 0)
+  control = None
+  command = None
+  i = 0
+  def numbers(count):
+    nonlocal i
+    values = [float(v) for v in tokens[i:i + count]]
+    i += count
+    return values
+  while i < len(tokens):
+    if re.match("[A-Za-z]", tokens[i]):
+      command = tokens[i]
+      i += 1
+      if command in "Zz":
+        polylines[-1].append(start)
+        x, y = start
+        continue
+    relative = command.islower()
+    origin = (x, y) if relative else (0, 0)
+    kind = command.upper()
+    if kind == "M":
+      dx, dy = numbers(2)
+      x, y = origin[0] + dx, origin[1] + dy
+      start = (x, y)
+      polylines.append([start])
+      # Further pairs after a move are lines.
+      command = "l" if relative else "L"
+    elif kind in "LT":
+      dx, dy = numbers(2)
+      x, y = origin[0] + dx, origin[1] + dy
+      polylines[-1].append((x, y))
+    elif kind == "H":
+      x = origin[0] + numbers(1)[0]
+      polylines[-1].append((x, y))
+    elif kind == "V":
+      y = origin[1] + numbers(1)[0]
+      polylines[-1].append((x, y))
+    elif kind in "CSQ":
+      count = {"C": 6, "S": 4, "Q": 4}[kind]
+      values = numbers(count)
+      points = [(origin[0] + values[k], origin[1] + values[k + 1]) for k in range(0, count, 2)]
+      if kind == "S":
+        points = [(2 * x - control[0], 2 * y - control[1]) if control else (x, y)] + points
+      polylines[-1] += bezier([(x, y)] + points)
+      control = points[-2]
+      x, y = points[-1]
+      continue
+    elif kind == "A":
+      values = numbers(7)
+      x, y = origin[0] + values[5], origin[1] + values[6]
+      polylines[-1].append((x, y))
+    control = None
+  return polylines
+
+def svg_drawing(path):
+  # Polylines of the lines, polylines, polygons, rectangles, circles, ellipses and paths of an SVG file,
+  # scaled to fit the canvas. Transforms and stroke widths are ignored.
+  root = ElementTree.parse(path).getroot()
+  polylines = []
+  for element in root.iter():
+    tag = element.tag.split("}")[-1]
+    get = lambda name: svg_length(element.get(name, "0"))
+    if tag == "line":
+      polylines.append([(get("x1"), get("y1")), (get("x2"), get("y2"))])
+    elif tag in ("polyline", "polygon"):
+      values = [float(v) for v in re.findall(r"[-+]?[0-9.]+(?:[eE][-+]?[0-9]+)?", element.get("points", ""))]
+      points = list(zip(values[0::2], values[1::2]))
+      polylines.append(points + points[:1] if tag == "polygon" else points)
+    elif tag == "rect":
+      x, y, w, h = get("x"), get("y"), get("width"), get("height")
+      polylines.append([(x, y), (x + w, y), (x + w, y + h), (x, y + h), (x, y)])
+    elif tag == "circle":
+      polylines.append(arc(get("cx"), get("cy"), get("r"), get("r")))
+    elif tag == "ellipse":
+      polylines.append(arc(get("cx"), get("cy"), get("rx"), get("ry")))
+    elif tag == "path":
+      polylines += path_polylines(element.get("d", ""))
+  if root.get("viewBox"):
+    left, top, width, height = [float(v) for v in re.split(r"[\s,]+", root.get("viewBox").strip())]
+  else:
+    left, top = 0, 0
+    width, height = svg_length(root.get("width", str(WIDTH))), svg_length(root.get("height", str(HEIGHT)))
+  scale = min((WIDTH - 1) / width, (HEIGHT - 1) / height)
+  drawing = []
+  for polyline in polylines:
+    points = []
+    for x, y in polyline:
+      point = (min(max(int(round((x - left) * scale)), 0), WIDTH - 1), min(max(int(round((y - top) * scale)), 0), HEIGHT - 1))
+      if not points or point != points[-1]:
+        points.append(point)
+    if points:
+      drawing.append(points)
+  return drawing
+
+def route(drawing, x, y):
+  # Order polylines by nearest neighbour from x, y, each drawn from its nearest end.
+  left = list(drawing)
+  order = []
+  while left:
+    near = min(range(0, len(left)), key=lambda i: min(abs(left[i][0][0] - x) + abs(left[i][0][1] - y),
+                                                      abs(left[i][-1][0] - x) + abs(left[i][-1][1] - y)))
+    polyline = left.pop(near)
+    if abs(polyline[-1][0] - x) + abs(polyline[-1][1] - y) < abs(polyline[0][0] - x) + abs(polyline[0][1] - y):
+      polyline = polyline[::-1]
+    order.append(polyline)
+    x, y = polyline[-1]
+  return order
+
+def drawing_plan(drawing, pixels=False):
+  # Plan drawing the polylines, from the top left corner: the pen pressed first at every start.
+  # Pixel paths are fitted with strokes in the way they are drawn, as strokes going back along
+  # the same line may round differently.
+  plan = []
+  x = y = 0
+  for polyline in route(drawing, 0, 0):
+    if pixels:
+      polyline = fit(polyline)
+    if polyline[0] != (x, y):
+      plan.append(("move", polyline[0][0] - x, polyline[0][1] - y))
+    plan.append(("dot",))
+    for (ax, ay), (bx, by) in zip(polyline[:-1], polyline[1:]):
+      plan.append(("stroke", bx - ax, by - ay))
+    x, y = polyline[-1]
+  return plan
+
+def drawing_time(plan):
+  # Seconds from plugging in to DONE.
+  return (SYNC_MS + plan_steps(plan) * report_ms()) / 1000
+
+def main(argv):
+  opts, args = getopt.getopt(argv, "hi")
+  invertColormap = False
+
+  for opt, arg in opts:
+    if opt == '-h':
+      usage()
+      sys.exit()
+    elif opt == '-i':
+      invertColormap = True
+
+  from png2c import load, image_bits
+  for path in args:
+    if path.lower().endswith(".svg"):
+      drawing = svg_drawing(path)
+      bits = None
+    else:
+      bits = image_bits(load(path), invertColormap)
+      drawing = image_drawing(bits)
+    plan = drawing_plan(drawing, bits is not None)
+    print("{}: {} strokes in {} polylines, {:.0f} s, plan of {} bytes".format(path, sum(c[0] == "stroke" for c in plan),
+      len(drawing), drawing_time(plan), len(encode_plan(plan))))
+    if bits is not None:
+      drawn = plan_pixels(plan)
+      print("  {} pixels of the drawing, {} drawn, {} drawn outside it".format(int(bits.sum()), int(drawn.sum()), int((drawn & ~bits).sum())))
+
+def usage():
+  print("To estimate the print time of a line drawing as strokes: vector.py <yourDrawing.svg|yourImage.png> ...")
+  print("To draw the white lines of an image: vector.py -i <yourImage.png> ...")
+
+if __name__ == "__main__":
+  if len(sys.argv[1:]) == 0:
+    usage()
+    sys.exit
+  else:
+    main(sys.argv[1:])